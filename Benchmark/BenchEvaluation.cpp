@@ -0,0 +1,89 @@
+#include "Evaluation.h"
+#include "benchmark/benchmark.h"
+
+#include <random>
+#include <vector>
+
+namespace Groebner::Bench {
+namespace {
+    using Field = Modulo<1000003>;
+    using Poly = Polynomial<Field, GrevlexOrder>;
+
+    Poly MakePoly(size_t count) {
+        std::mt19937_64 gen(7);
+        std::uniform_int_distribution<int64_t> coef_dist(1, 1000002);
+        std::uniform_int_distribution<Monomial::DegreeType> degree_dist(0, 5);
+        std::vector<ModuloTerm<1000003>> terms;
+        for (size_t i = 0; i < count; i++) {
+            terms.push_back({coef_dist(gen),
+                             {degree_dist(gen), degree_dist(gen),
+                              degree_dist(gen), degree_dist(gen)}});
+        }
+        return Poly(std::move(terms));
+    }
+
+    std::vector<std::vector<Field>> MakePoints(size_t count) {
+        std::mt19937_64 gen(8);
+        std::uniform_int_distribution<int64_t> value_dist(0, 1000002);
+        std::vector<std::vector<Field>> result(count);
+        for (auto& point : result) {
+            for (size_t var = 0; var < 4; var++) {
+                point.push_back(value_dist(gen));
+            }
+        }
+        return result;
+    }
+
+    // term loop over GetAt, the way points used to be checked
+    [[gnu::noinline]] Field EvaluateReference(const Poly& poly,
+                                              const std::vector<Field>& point) {
+        Field result = 0;
+        for (size_t i = 0; i < poly.GetSize(); i++) {
+            auto term = poly.GetAt(i);
+            Field value = term.coef;
+            for (size_t var = 0; var < term.degree.GetSize(); var++) {
+                for (size_t e = 0; e < term.degree.GetDegree(var); e++) {
+                    value *= point[var];
+                }
+            }
+            result += value;
+        }
+        return result;
+    }
+}  // namespace
+
+void BM_EvaluateReference(benchmark::State& state) {
+    auto poly = MakePoly(state.range(0));
+    auto points = MakePoints(1 << 12);
+    for (auto _ : state) {
+        for (const auto& point : points) {
+            benchmark::DoNotOptimize(EvaluateReference(poly, point));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * points.size());
+}
+BENCHMARK(BM_EvaluateReference)->Arg(16)->Arg(64);
+
+void BM_EvaluateSinglePoint(benchmark::State& state) {
+    auto poly = MakePoly(state.range(0));
+    auto points = MakePoints(1 << 12);
+    for (auto _ : state) {
+        for (const auto& point : points) {
+            benchmark::DoNotOptimize(
+                Evaluate(poly, std::span<const Field>(point)));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * points.size());
+}
+BENCHMARK(BM_EvaluateSinglePoint)->Arg(16)->Arg(64);
+
+void BM_EvaluateBatch(benchmark::State& state) {
+    auto poly = MakePoly(state.range(0));
+    PointBatch<Field> batch(MakePoints(1 << 12));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Evaluate(poly, batch));
+    }
+    state.SetItemsProcessed(state.iterations() * batch.GetSize());
+}
+BENCHMARK(BM_EvaluateBatch)->Arg(16)->Arg(64);
+}  // namespace Groebner::Bench
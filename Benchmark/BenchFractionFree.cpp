@@ -0,0 +1,75 @@
+#include "GroebnerAlgorithm.h"
+#include "benchmark/benchmark.h"
+
+#include <random>
+#include <vector>
+
+namespace Groebner::Bench {
+namespace {
+    // Katsura-3: u_0 + 2 u_1 + 2 u_2 + 2 u_3 = 1 and
+    // sum u_i u_{m - i} = u_m for m = 0, 1, 2 over i = -3..3, u_{-i} = u_i
+    template <IsSupportedField Field>
+    PolySystem<Field, GrevlexOrder> MakeKatsura() {
+        using Poly = Polynomial<Field, GrevlexOrder>;
+        return PolySystem<Field, GrevlexOrder>(
+            {Poly{{1, {1}}, {2, {0, 1}}, {2, {0, 0, 1}}, {2, {0, 0, 0, 1}},
+                  {-1, {}}},
+             Poly{{1, {2}},
+                  {2, {0, 2}},
+                  {2, {0, 0, 2}},
+                  {2, {0, 0, 0, 2}},
+                  {-1, {1}}},
+             Poly{{2, {1, 1}},
+                  {2, {0, 1, 1}},
+                  {2, {0, 0, 1, 1}},
+                  {-1, {0, 1}}},
+             Poly{{2, {1, 0, 1}},
+                  {1, {0, 2}},
+                  {2, {0, 1, 0, 1}},
+                  {-1, {0, 0, 1}}}});
+    }
+
+    // random coefficients with small denominators
+    template <IsSupportedField Field>
+    PolySystem<Field, GrevlexOrder> MakeRandom() {
+        std::mt19937_64 gen(49);
+        std::uniform_int_distribution<int64_t> coef(-9, 9);
+        PolySystem<Field, GrevlexOrder> system;
+        for (size_t i = 0; i < 3; i++) {
+            std::vector<Term<Field>> terms;
+            for (size_t j = 0; j < 4; j++) {
+                terms.push_back({Field(coef(gen), 1 + gen() % 3),
+                                 {gen() % 3, gen() % 3, gen() % 2}});
+            }
+            system.Add(Polynomial<Field, GrevlexOrder>(std::move(terms)));
+        }
+        return system;
+    }
+
+    template <IsSupportedField Field>
+    void Build(benchmark::State& state,
+               const PolySystem<Field, GrevlexOrder>& system) {
+        auto mode = state.range(0) ? CoefficientMode::FractionFree
+                                   : CoefficientMode::Fractions;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(GroebnerAlgorithm::BuildGB(
+                system, AutoReduction::Disabled, mode));
+        }
+    }
+}  // namespace
+
+void BM_KatsuraRational(benchmark::State& state) {
+    Build(state, MakeKatsura<Rational>());
+}
+BENCHMARK(BM_KatsuraRational)->Arg(false)->Arg(true);
+
+void BM_KatsuraBigRational(benchmark::State& state) {
+    Build(state, MakeKatsura<BigRational>());
+}
+BENCHMARK(BM_KatsuraBigRational)->Arg(false)->Arg(true);
+
+void BM_RandomBigRational(benchmark::State& state) {
+    Build(state, MakeRandom<BigRational>());
+}
+BENCHMARK(BM_RandomBigRational)->Arg(false)->Arg(true);
+}  // namespace Groebner::Bench
@@ -0,0 +1,123 @@
+#include "GroebnerAlgorithm.h"
+#include "benchmark/benchmark.h"
+
+#include <random>
+#include <vector>
+
+namespace Groebner::Bench {
+namespace {
+    constexpr size_t kSize = 1 << 12;
+    constexpr int64_t kP = 3;
+    constexpr size_t kK = 4;
+    using Extension = GaloisField<kP, kK>;
+    // emulation: the root is one more variable, the last one
+    using Base = Modulo<kP>;
+    constexpr size_t kVarsCount = 2;
+
+    template <typename Field>
+    std::vector<Field> MakeValues(size_t seed) {
+        std::mt19937_64 gen(seed);
+        std::vector<Field> result;
+        for (size_t i = 0; i < kSize; i++) {
+            std::vector<int64_t> coefs(Field::GetDegree());
+            for (auto& coef : coefs) {
+                coef = gen() % Field::GetCharacteristic();
+            }
+            result.push_back(Field::FromCoefficients(coefs));
+        }
+        return result;
+    }
+
+    template <typename Field>
+    void DotProduct(benchmark::State& state) {
+        auto lhs = MakeValues<Field>(1);
+        auto rhs = MakeValues<Field>(2);
+        for (auto _ : state) {
+            Field sum;
+            for (size_t i = 0; i < kSize; i++) {
+                sum += lhs[i] * rhs[i];
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * kSize);
+    }
+
+    // random dense quadratics in kVarsCount variables over GF(3^4)
+    std::vector<std::vector<Term<Extension>>> MakeSystem() {
+        std::mt19937_64 gen(3);
+        std::vector<std::vector<Term<Extension>>> system(kVarsCount);
+        for (auto& terms : system) {
+            for (size_t i = 0; i < 6; i++) {
+                Monomial degree(kVarsCount);
+                for (size_t j = 0, left = 2; j < kVarsCount; j++) {
+                    size_t value = gen() % (left + 1);
+                    degree.SetDegree(j, value);
+                    left -= value;
+                }
+                std::vector<int64_t> coefs(kK);
+                for (auto& coef : coefs) {
+                    coef = gen() % kP;
+                }
+                terms.push_back(
+                    {Extension::FromCoefficients(coefs), std::move(degree)});
+            }
+        }
+        return system;
+    }
+}  // namespace
+
+void BM_GaloisFieldDot(benchmark::State& state) {
+    DotProduct<Extension>(state);
+}
+BENCHMARK(BM_GaloisFieldDot);
+
+void BM_GaloisFieldDotLarge(benchmark::State& state) {
+    DotProduct<GaloisField<1000000007, 4>>(state);
+}
+BENCHMARK(BM_GaloisFieldDotLarge);
+
+void BM_GaloisFieldBasis(benchmark::State& state) {
+    PolySystem<Extension, GrevlexOrder> system;
+    for (auto& terms : MakeSystem()) {
+        system.Add(Polynomial<Extension, GrevlexOrder>(std::move(terms)));
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(GroebnerAlgorithm::BuildGB(system));
+    }
+}
+BENCHMARK(BM_GaloisFieldBasis);
+
+// the same system over F_3 with the root as a variable
+// and its defining polynomial added
+void BM_GaloisFieldBasisEmulated(benchmark::State& state) {
+    using Poly = Polynomial<Base, GrevlexOrder>;
+    PolySystem<Base, GrevlexOrder> system;
+    for (auto& terms : MakeSystem()) {
+        std::vector<Term<Base>> emulated;
+        for (auto& [coef, degree] : terms) {
+            for (size_t i = 0; i < kK; i++) {
+                Monomial shifted(kVarsCount + 1);
+                for (size_t j = 0; j < kVarsCount; j++) {
+                    shifted.SetDegree(j, degree.GetDegree(j));
+                }
+                shifted.SetDegree(kVarsCount, i);
+                emulated.push_back({coef.GetCoefficient(i), shifted});
+            }
+        }
+        system.Add(Poly(std::move(emulated)));
+    }
+    std::vector<Term<Base>> minimal;
+    const auto& modulus = Extension::GetDefiningPolynomial();
+    for (size_t i = 0; i < modulus.size(); i++) {
+        Monomial degree(kVarsCount + 1);
+        degree.SetDegree(kVarsCount, i);
+        minimal.push_back({modulus[i], std::move(degree)});
+    }
+    system.Add(Poly(std::move(minimal)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(GroebnerAlgorithm::BuildGB(system));
+    }
+}
+BENCHMARK(BM_GaloisFieldBasisEmulated);
+}  // namespace Groebner::Bench
@@ -0,0 +1,104 @@
+#include "BitMatrix.h"
+#include "Polynomial.h"
+#include "benchmark/benchmark.h"
+
+#include <random>
+#include <vector>
+
+namespace Groebner::Bench {
+namespace {
+    // Gauss-Jordan on rows of field elements, as a generic matrix would do
+    template <typename Field>
+    size_t EliminateDense(std::vector<std::vector<Field>>& rows) {
+        size_t rank = 0;
+        size_t cols = rows.empty() ? 0 : rows[0].size();
+        for (size_t col = 0; col < cols && rank < rows.size(); col++) {
+            size_t pivot = rank;
+            while (pivot < rows.size() && rows[pivot][col].IsZero()) {
+                pivot++;
+            }
+            if (pivot == rows.size()) {
+                continue;
+            }
+            std::swap(rows[rank], rows[pivot]);
+            for (size_t row = 0; row < rows.size(); row++) {
+                if (row == rank || rows[row][col].IsZero()) {
+                    continue;
+                }
+                Field factor = rows[row][col] / rows[rank][col];
+                for (size_t j = col; j < cols; j++) {
+                    rows[row][j] -= factor * rows[rank][j];
+                }
+            }
+            rank++;
+        }
+        return rank;
+    }
+
+    std::vector<std::vector<bool>> MakeBits(size_t size) {
+        std::mt19937_64 gen(1);
+        std::vector<std::vector<bool>> bits(size, std::vector<bool>(size));
+        for (auto& row : bits) {
+            for (size_t j = 0; j < size; j++) {
+                row[j] = gen() & 1;
+            }
+        }
+        return bits;
+    }
+
+    template <typename Field>
+    Polynomial<Field> MakePoly(size_t seed, size_t size) {
+        std::mt19937_64 gen(seed);
+        std::vector<Term<Field>> terms;
+        for (size_t i = 0; i < size; i++) {
+            terms.push_back({1, {gen() % 8, gen() % 8, gen() % 8, gen() % 8}});
+        }
+        return Polynomial<Field>(std::move(terms));
+    }
+
+    template <typename Field>
+    void Multiply(benchmark::State& state) {
+        auto lhs = MakePoly<Field>(1, 200);
+        auto rhs = MakePoly<Field>(2, 200);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(lhs * rhs);
+        }
+    }
+}  // namespace
+
+void BM_EliminateModulo2(benchmark::State& state) {
+    auto bits = MakeBits(state.range(0));
+    for (auto _ : state) {
+        std::vector<std::vector<Modulo<2>>> rows;
+        for (const auto& row : bits) {
+            rows.emplace_back(row.begin(), row.end());
+        }
+        benchmark::DoNotOptimize(EliminateDense(rows));
+    }
+}
+BENCHMARK(BM_EliminateModulo2)->Arg(256)->Arg(1024);
+
+void BM_EliminateBitMatrix(benchmark::State& state) {
+    auto bits = MakeBits(state.range(0));
+    for (auto _ : state) {
+        BitMatrix matrix(bits.size(), bits.size());
+        for (size_t i = 0; i < bits.size(); i++) {
+            for (size_t j = 0; j < bits.size(); j++) {
+                matrix.Set(i, j, bits[i][j]);
+            }
+        }
+        benchmark::DoNotOptimize(matrix.Eliminate());
+    }
+}
+BENCHMARK(BM_EliminateBitMatrix)->Arg(256)->Arg(1024);
+
+void BM_MultiplyModulo2(benchmark::State& state) {
+    Multiply<Modulo<2>>(state);
+}
+BENCHMARK(BM_MultiplyModulo2);
+
+void BM_MultiplyGf2(benchmark::State& state) {
+    Multiply<Gf2>(state);
+}
+BENCHMARK(BM_MultiplyGf2);
+}  // namespace Groebner::Bench
@@ -0,0 +1,225 @@
+#include "Inversion.h"
+#include "Modulo.h"
+#include "RuntimeModulo.h"
+#include "benchmark/benchmark.h"
+
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace Groebner::Bench {
+namespace {
+    // the division based arithmetic Modulo had before Barrett reduction
+    namespace Reference {
+        template <int64_t Modulus>
+        class Modulo {
+            public:
+                Modulo(int64_t value = 0) : value_(value) { Normalize(); }
+
+                Modulo& operator+=(const Modulo& other) {
+                    value_ += other.value_;
+                    Normalize();
+                    return *this;
+                }
+
+                Modulo& operator-=(const Modulo& other) {
+                    value_ -= other.value_;
+                    Normalize();
+                    return *this;
+                }
+
+                Modulo& operator*=(const Modulo& other) {
+                    value_ *= other.value_;
+                    Normalize();
+                    return *this;
+                }
+
+                Modulo operator*(const Modulo& other) const {
+                    Modulo temp(*this);
+                    temp *= other;
+                    return temp;
+                }
+
+            private:
+                void Normalize() {
+                    if (value_ < 0) {
+                        value_ = (value_ % Modulus + Modulus) % Modulus;
+                    } else {
+                        value_ = value_ % Modulus;
+                    }
+                }
+
+                int64_t value_;
+        };
+
+        // 128-bit product and division, the plain fix for large moduli
+        template <int64_t Modulus>
+        class WideModulo {
+            public:
+                WideModulo(int64_t value = 0) : value_(value % Modulus) {}
+
+                WideModulo& operator+=(const WideModulo& other) {
+                    value_ += other.value_;
+                    value_ -= value_ >= Modulus ? Modulus : 0;
+                    return *this;
+                }
+
+                WideModulo operator*(const WideModulo& other) const {
+                    WideModulo temp;
+                    temp.value_ = static_cast<int64_t>(
+                        static_cast<unsigned __int128>(value_) * other.value_ %
+                        Modulus);
+                    return temp;
+                }
+
+            private:
+                int64_t value_;
+        };
+    }  // namespace Reference
+
+    constexpr int64_t kModulus = 998244353;
+    constexpr int64_t kLargeModulus = 9223372036854775783;
+    constexpr size_t kSize = 1 << 12;
+
+    template <typename Field>
+    std::vector<Field> MakeValues(size_t seed) {
+        std::mt19937_64 gen(seed);
+        std::uniform_int_distribution<int64_t> value_dist(
+            0, std::numeric_limits<int64_t>::max());
+        std::vector<Field> result;
+        for (size_t i = 0; i < kSize; i++) {
+            result.push_back(value_dist(gen));
+        }
+        return result;
+    }
+
+    // a dot product exercises the multiply-add of every reduction step
+    template <typename Field>
+    void DotProduct(benchmark::State& state) {
+        auto lhs = MakeValues<Field>(1);
+        auto rhs = MakeValues<Field>(2);
+        for (auto _ : state) {
+            Field sum = 0;
+            for (size_t i = 0; i < kSize; i++) {
+                sum += lhs[i] * rhs[i];
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * kSize);
+    }
+
+    template <typename Field>
+    void AddSub(benchmark::State& state) {
+        auto lhs = MakeValues<Field>(1);
+        auto rhs = MakeValues<Field>(2);
+        for (auto _ : state) {
+            for (size_t i = 0; i < kSize; i++) {
+                lhs[i] += rhs[i];
+                rhs[i] -= lhs[i];
+            }
+            benchmark::DoNotOptimize(lhs.data());
+            benchmark::DoNotOptimize(rhs.data());
+        }
+        state.SetItemsProcessed(state.iterations() * kSize);
+    }
+
+    template <typename Field>
+    std::vector<Field> MakeNonZeroValues(size_t seed) {
+        auto result = MakeValues<Field>(seed);
+        for (Field& value : result) {
+            value = value.IsZero() ? Field(1) : value;
+        }
+        return result;
+    }
+
+    template <typename Field>
+    void InverseEach(benchmark::State& state) {
+        auto values = MakeNonZeroValues<Field>(1);
+        for (auto _ : state) {
+            for (Field& value : values) {
+                value = Field(1) / value;
+            }
+            benchmark::DoNotOptimize(values.data());
+        }
+        state.SetItemsProcessed(state.iterations() * kSize);
+    }
+
+    template <typename Field>
+    void InverseBatch(benchmark::State& state) {
+        auto values = MakeNonZeroValues<Field>(1);
+        for (auto _ : state) {
+            Details::InvertBatch(std::span(values));
+            benchmark::DoNotOptimize(values.data());
+        }
+        state.SetItemsProcessed(state.iterations() * kSize);
+    }
+}  // namespace
+
+void BM_ModuloDotReference(benchmark::State& state) {
+    DotProduct<Reference::Modulo<kModulus>>(state);
+}
+BENCHMARK(BM_ModuloDotReference);
+
+void BM_ModuloDot(benchmark::State& state) {
+    DotProduct<Modulo<kModulus>>(state);
+}
+BENCHMARK(BM_ModuloDot);
+
+void BM_RuntimeModuloDot(benchmark::State& state) {
+    RuntimeModulo::Scope scope(kModulus);
+    DotProduct<RuntimeModulo>(state);
+}
+BENCHMARK(BM_RuntimeModuloDot);
+
+void BM_ModuloAddSubReference(benchmark::State& state) {
+    AddSub<Reference::Modulo<kModulus>>(state);
+}
+BENCHMARK(BM_ModuloAddSubReference);
+
+void BM_ModuloAddSub(benchmark::State& state) {
+    AddSub<Modulo<kModulus>>(state);
+}
+BENCHMARK(BM_ModuloAddSub);
+
+void BM_ModuloDotLargeReference(benchmark::State& state) {
+    DotProduct<Reference::WideModulo<kLargeModulus>>(state);
+}
+BENCHMARK(BM_ModuloDotLargeReference);
+
+void BM_ModuloDotLarge(benchmark::State& state) {
+    DotProduct<Modulo<kLargeModulus>>(state);
+}
+BENCHMARK(BM_ModuloDotLarge);
+
+void BM_RuntimeModuloDotLarge(benchmark::State& state) {
+    RuntimeModulo::Scope scope(kLargeModulus);
+    DotProduct<RuntimeModulo>(state);
+}
+BENCHMARK(BM_RuntimeModuloDotLarge);
+
+void BM_ModuloInverse(benchmark::State& state) {
+    InverseEach<Modulo<kModulus>>(state);
+}
+BENCHMARK(BM_ModuloInverse);
+
+void BM_ModuloInvertBatch(benchmark::State& state) {
+    InverseBatch<Modulo<kModulus>>(state);
+}
+BENCHMARK(BM_ModuloInvertBatch);
+
+void BM_ModuloInverseLarge(benchmark::State& state) {
+    InverseEach<Modulo<kLargeModulus>>(state);
+}
+BENCHMARK(BM_ModuloInverseLarge);
+
+void BM_ModuloInvertBatchLarge(benchmark::State& state) {
+    InverseBatch<Modulo<kLargeModulus>>(state);
+}
+BENCHMARK(BM_ModuloInvertBatchLarge);
+
+// every inverse is a lookup in the table of the field
+void BM_ModuloInverseTable(benchmark::State& state) {
+    InverseEach<Modulo<65521>>(state);
+}
+BENCHMARK(BM_ModuloInverseTable);
+}  // namespace Groebner::Bench
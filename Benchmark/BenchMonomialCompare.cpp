@@ -0,0 +1,126 @@
+#include "MonomialCompare.h"
+#include "benchmark/benchmark.h"
+
+#include <random>
+#include <vector>
+
+namespace Groebner::Bench {
+namespace {
+    // Out-of-line comparators with bounds-checked access,
+    // kept as the baseline the inline kernels are measured against.
+    namespace Reference {
+        [[gnu::noinline]] bool IsEqual(const Monomial& lhs,
+                                       const Monomial& rhs) {
+            for (size_t i = 0; i < std::max(lhs.GetSize(), rhs.GetSize());
+                 ++i) {
+                if (lhs.GetDegree(i) != rhs.GetDegree(i)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        [[gnu::noinline]] bool LexIsLess(const Monomial& lhs,
+                                         const Monomial& rhs) {
+            for (size_t i = 0; i < std::max(lhs.GetSize(), rhs.GetSize());
+                 ++i) {
+                auto lhs_degree = lhs.GetDegree(i);
+                auto rhs_degree = rhs.GetDegree(i);
+                if (lhs_degree != rhs_degree) {
+                    return lhs_degree < rhs_degree;
+                }
+            }
+            return false;
+        }
+
+        [[gnu::noinline]] bool ReverseLexIsLess(const Monomial& lhs,
+                                                const Monomial& rhs) {
+            auto sz = std::max(lhs.GetSize(), rhs.GetSize());
+            for (size_t i = 0; i < sz; ++i) {
+                auto lhs_degree = lhs.GetDegree(sz - i - 1);
+                auto rhs_degree = rhs.GetDegree(sz - i - 1);
+                if (lhs_degree != rhs_degree) {
+                    return lhs_degree > rhs_degree;
+                }
+            }
+            return false;
+        }
+
+        [[gnu::noinline]] bool GrlexIsLess(const Monomial& lhs,
+                                           const Monomial& rhs) {
+            if (lhs.GetSumDegree() != rhs.GetSumDegree()) {
+                return lhs.GetSumDegree() < rhs.GetSumDegree();
+            }
+            return LexIsLess(lhs, rhs);
+        }
+
+        [[gnu::noinline]] bool GrevlexIsLess(const Monomial& lhs,
+                                             const Monomial& rhs) {
+            if (lhs.GetSumDegree() != rhs.GetSumDegree()) {
+                return lhs.GetSumDegree() < rhs.GetSumDegree();
+            }
+            return ReverseLexIsLess(lhs, rhs);
+        }
+
+        // the old IsLessOrEqual made two passes
+        [[gnu::noinline]] bool LexIsLessOrEqual(const Monomial& lhs,
+                                                const Monomial& rhs) {
+            return LexIsLess(lhs, rhs) || IsEqual(lhs, rhs);
+        }
+    }  // namespace Reference
+
+    // monomials of equal total degree that share a long common prefix,
+    // which is the expensive case for every order
+    std::vector<Monomial> MakeMonomials(size_t vars, size_t count) {
+        std::mt19937_64 gen(42);
+        std::uniform_int_distribution<Monomial::DegreeType> dist(0, 3);
+        std::vector<Monomial> result;
+        result.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            Monomial monomial(vars);
+            for (size_t j = 0; j < vars; j++) {
+                monomial.SetDegree(j, j < vars / 2 ? 1 : dist(gen));
+            }
+            result.push_back(std::move(monomial));
+        }
+        return result;
+    }
+
+    template <typename Functor>
+    void RunPairs(benchmark::State& state, Functor functor) {
+        auto monomials = MakeMonomials(state.range(0), 1024);
+        size_t i = 0;
+        for (auto _ : state) {
+            const auto& lhs = monomials[i % monomials.size()];
+            const auto& rhs = monomials[(i * 7 + 1) % monomials.size()];
+            benchmark::DoNotOptimize(functor(lhs, rhs));
+            ++i;
+        }
+    }
+}  // namespace
+
+#define GROEBNER_COMPARE_BENCHMARK(name, functor)            \
+    void name(benchmark::State& state) {                     \
+        RunPairs(state, functor);                            \
+    }                                                        \
+    BENCHMARK(name)->Arg(3)->Arg(8)->Arg(32)
+
+GROEBNER_COMPARE_BENCHMARK(BM_EqualReference, Reference::IsEqual);
+GROEBNER_COMPARE_BENCHMARK(BM_EqualInline, StraightCoordinateOrder::IsEqual);
+
+GROEBNER_COMPARE_BENCHMARK(BM_LexReference, Reference::LexIsLess);
+GROEBNER_COMPARE_BENCHMARK(BM_LexInline, LexOrder::IsLess);
+
+GROEBNER_COMPARE_BENCHMARK(BM_LexLessOrEqualReference,
+                           Reference::LexIsLessOrEqual);
+GROEBNER_COMPARE_BENCHMARK(BM_LexLessOrEqualInline, LexOrder::IsLessOrEqual);
+
+GROEBNER_COMPARE_BENCHMARK(BM_ReverseLexReference, Reference::ReverseLexIsLess);
+GROEBNER_COMPARE_BENCHMARK(BM_ReverseLexInline, ReverseLexOrder::IsLess);
+
+GROEBNER_COMPARE_BENCHMARK(BM_GrlexReference, Reference::GrlexIsLess);
+GROEBNER_COMPARE_BENCHMARK(BM_GrlexInline, GrlexOrder::IsLess);
+
+GROEBNER_COMPARE_BENCHMARK(BM_GrevlexReference, Reference::GrevlexIsLess);
+GROEBNER_COMPARE_BENCHMARK(BM_GrevlexInline, GrevlexOrder::IsLess);
+}  // namespace Groebner::Bench
@@ -0,0 +1,188 @@
+#include "PolyExpression.h"
+#include "Polynomial.h"
+#include "benchmark/benchmark.h"
+
+#include <map>
+#include <random>
+#include <vector>
+
+namespace Groebner::Bench {
+namespace {
+    // term by term insertion, the way polynomials used to be loaded
+    namespace Reference {
+        template <IsComparator Comparator>
+        [[gnu::noinline]] Polynomial<Rational, Comparator> Build(
+            const std::vector<RationalTerm>& terms) {
+            Polynomial<Rational, Comparator> result;
+            for (const auto& term : terms) {
+                result += term;
+            }
+            return result;
+        }
+
+        // every product term inserted into a map, the old operator*=
+        template <IsComparator Comparator>
+        struct Greater {
+                bool operator()(const Monomial& lhs,
+                                const Monomial& rhs) const {
+                    return Comparator::IsGreater(lhs, rhs);
+                }
+        };
+
+        template <IsComparator Comparator>
+        [[gnu::noinline]] std::map<Monomial, Rational, Greater<Comparator>>
+        Multiply(const Polynomial<Rational, Comparator>& lhs,
+                 const Polynomial<Rational, Comparator>& rhs) {
+            std::map<Monomial, Rational, Greater<Comparator>> result;
+            for (const auto& [rhs_degree, rhs_coef] : rhs) {
+                for (const auto& [lhs_degree, lhs_coef] : lhs) {
+                    result[rhs_degree + lhs_degree] += rhs_coef * lhs_coef;
+                }
+            }
+            return result;
+        }
+    }  // namespace Reference
+
+    // mostly distinct monomials with some repeats
+    std::vector<RationalTerm> MakeTerms(size_t count) {
+        std::mt19937_64 gen(42);
+        std::uniform_int_distribution<Monomial::DegreeType> degree_dist(0, 9);
+        std::uniform_int_distribution<int64_t> coef_dist(-5, 5);
+        std::vector<RationalTerm> result;
+        result.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            result.push_back({coef_dist(gen),
+                              {degree_dist(gen), degree_dist(gen),
+                               degree_dist(gen), degree_dist(gen),
+                               degree_dist(gen), degree_dist(gen)}});
+        }
+        return result;
+    }
+
+    // sparse: random monomials in many variables, heap merge
+    // dense: all monomials of a small box, dense accumulation
+    Polynomial<Rational, GrevlexOrder> MakeFactor(bool is_dense,
+                                                  size_t count, size_t seed) {
+        std::mt19937_64 gen(seed);
+        std::uniform_int_distribution<int64_t> coef_dist(1, 5);
+        std::uniform_int_distribution<Monomial::DegreeType> degree_dist(0, 20);
+        std::vector<RationalTerm> terms;
+        for (size_t i = 0; i < count; i++) {
+            Monomial degree;
+            if (is_dense) {
+                degree = Monomial({i % 16, i / 16});
+            } else {
+                degree = Monomial({degree_dist(gen), degree_dist(gen),
+                                   degree_dist(gen), degree_dist(gen)});
+            }
+            terms.push_back({coef_dist(gen), std::move(degree)});
+        }
+        return Polynomial<Rational, GrevlexOrder>(std::move(terms));
+    }
+}  // namespace
+
+void BM_MultiplyReference(benchmark::State& state) {
+    auto lhs = MakeFactor(state.range(0), 256, 1);
+    auto rhs = MakeFactor(state.range(0), 256, 2);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Reference::Multiply(lhs, rhs));
+    }
+}
+BENCHMARK(BM_MultiplyReference)->Arg(false)->Arg(true);
+
+void BM_Multiply(benchmark::State& state) {
+    auto lhs = MakeFactor(state.range(0), 256, 1);
+    auto rhs = MakeFactor(state.range(0), 256, 2);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lhs * rhs);
+    }
+}
+BENCHMARK(BM_Multiply)->Arg(false)->Arg(true);
+
+// dense bivariate factors of degree `range` in each variable over Z_p
+void BM_MultiplyModulo(benchmark::State& state) {
+    using Field = Modulo<1000003>;
+    std::mt19937_64 gen(5);
+    std::uniform_int_distribution<int64_t> coef_dist(0, 1000002);
+    std::vector<ModuloTerm<1000003>> terms;
+    auto degree = static_cast<Monomial::DegreeType>(state.range(0));
+    for (Monomial::DegreeType i = 0; i <= degree; i++) {
+        for (Monomial::DegreeType j = 0; j <= degree; j++) {
+            terms.push_back({coef_dist(gen), {i, j}});
+        }
+    }
+    Polynomial<Field, GrevlexOrder> lhs(terms.begin(), terms.end());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lhs * lhs);
+    }
+}
+BENCHMARK(BM_MultiplyModulo)->Arg(10)->Arg(30)->Arg(50);
+
+// products over a prime too large for NTT, range(0) picks dense factors
+void BM_MultiplyLargePrime(benchmark::State& state) {
+    constexpr int64_t kPrime = 2305843009213693951;
+    using Field = Modulo<kPrime>;
+    std::mt19937_64 gen(6);
+    std::uniform_int_distribution<int64_t> coef_dist(0, kPrime - 1);
+    std::uniform_int_distribution<Monomial::DegreeType> degree_dist(0, 20);
+    std::vector<ModuloTerm<kPrime>> terms;
+    for (size_t i = 0; i < 256; i++) {
+        if (state.range(0)) {
+            terms.push_back({coef_dist(gen), {i % 16, i / 16}});
+        } else {
+            terms.push_back({coef_dist(gen),
+                             {degree_dist(gen), degree_dist(gen),
+                              degree_dist(gen), degree_dist(gen)}});
+        }
+    }
+    Polynomial<Field, GrevlexOrder> lhs(terms.begin(), terms.end());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lhs * lhs);
+    }
+}
+BENCHMARK(BM_MultiplyLargePrime)->Arg(false)->Arg(true);
+
+void BM_MultiplyParallel(benchmark::State& state) {
+    auto lhs = MakeFactor(false, 1024, 1);
+    auto rhs = MakeFactor(false, 1024, 2);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lhs.MultiplyParallel(rhs, state.range(0)));
+    }
+}
+BENCHMARK(BM_MultiplyParallel)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+void BM_BuildReference(benchmark::State& state) {
+    auto terms = MakeTerms(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Reference::Build<GrevlexOrder>(terms));
+    }
+}
+BENCHMARK(BM_BuildReference)->Arg(1 << 10)->Arg(1 << 16);
+
+void BM_BuildBulk(benchmark::State& state) {
+    auto terms = MakeTerms(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            Polynomial<Rational, GrevlexOrder>(terms.begin(), terms.end()));
+    }
+}
+BENCHMARK(BM_BuildBulk)->Arg(1 << 10)->Arg(1 << 16);
+
+// p * t1 - q * t2 + r, one temporary per operator against a single merge
+void BM_Combination(benchmark::State& state) {
+    auto p = MakeFactor(false, state.range(1), 1);
+    auto q = MakeFactor(false, state.range(1), 2);
+    auto r = MakeFactor(false, state.range(1), 3);
+    RationalTerm t1 = {2, {1, 0, 1}};
+    RationalTerm t2 = {3, {0, 2}};
+    for (auto _ : state) {
+        if (state.range(0)) {
+            benchmark::DoNotOptimize(
+                (Lazy(p) * t1 - Lazy(q) * t2 + Lazy(r)).Evaluate());
+        } else {
+            benchmark::DoNotOptimize(p * t1 - q * t2 + r);
+        }
+    }
+}
+BENCHMARK(BM_Combination)->ArgsProduct({{false, true}, {256, 4096}});
+}  // namespace Groebner::Bench
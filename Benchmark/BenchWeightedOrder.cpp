@@ -0,0 +1,131 @@
+#include "GroebnerAlgorithm.h"
+#include "WeightedOrder.h"
+#include "benchmark/benchmark.h"
+
+#include <random>
+#include <vector>
+
+namespace Groebner::Bench {
+namespace {
+    using Field = Modulo<1000003>;
+    using Weighted = WeightedOrder<Weights<1, 2, 3, 4, 5, 6, 7, 8>>;
+    using Elimination = BlockOrder<2, LexOrder, GrevlexOrder>;
+    using Matrix = MatrixOrder<Weights<1, 1, 1, 1, 1, 1, 1, 1>,
+                               Weights<8, 7, 6, 5, 4, 3, 2, 1>,
+                               Weights<1, 0, 1, 0, 1, 0, 1, 0>>;
+
+    // a fixed pool compared over and over,
+    // the best case for keys cached on the monomial
+    std::vector<Monomial> MakeMonomials(size_t vars, size_t count) {
+        std::mt19937_64 gen(28);
+        std::uniform_int_distribution<Monomial::DegreeType> dist(0, 3);
+        std::vector<Monomial> result;
+        result.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            Monomial monomial(vars);
+            for (size_t j = 0; j < vars; j++) {
+                monomial.SetDegree(j, dist(gen));
+            }
+            result.push_back(std::move(monomial));
+        }
+        return result;
+    }
+
+    template <IsComparator Comparator>
+    void RunPairs(benchmark::State& state) {
+        auto monomials = MakeMonomials(state.range(0), 1024);
+        size_t i = 0;
+        for (auto _ : state) {
+            const auto& lhs = monomials[i % monomials.size()];
+            const auto& rhs = monomials[(i * 7 + 1) % monomials.size()];
+            benchmark::DoNotOptimize(Comparator::IsLess(lhs, rhs));
+            ++i;
+        }
+    }
+
+    // product terms are fresh monomials, every key is used a few times
+    template <IsComparator Comparator>
+    Polynomial<Field, Comparator> MakeFactor(size_t count, size_t seed) {
+        std::mt19937_64 gen(seed);
+        std::uniform_int_distribution<int64_t> coef_dist(1, 1000);
+        std::uniform_int_distribution<Monomial::DegreeType> degree_dist(0, 20);
+        std::vector<Term<Field>> terms;
+        for (size_t i = 0; i < count; i++) {
+            terms.push_back({Field(coef_dist(gen)),
+                             {degree_dist(gen), degree_dist(gen),
+                              degree_dist(gen), degree_dist(gen)}});
+        }
+        return Polynomial<Field, Comparator>(std::move(terms));
+    }
+
+    template <IsComparator Comparator>
+    void RunMultiply(benchmark::State& state) {
+        auto lhs = MakeFactor<Comparator>(state.range(0), 1);
+        auto rhs = MakeFactor<Comparator>(state.range(0), 2);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(lhs * rhs);
+        }
+    }
+
+    // Katsura-3, reduction compares the same leaders many times
+    template <IsComparator Comparator>
+    void RunKatsura(benchmark::State& state) {
+        using Poly = Polynomial<Field, Comparator>;
+        PolySystem<Field, Comparator> system(
+            {Poly{{1, {1}}, {2, {0, 1}}, {2, {0, 0, 1}}, {2, {0, 0, 0, 1}},
+                  {-1, {}}},
+             Poly{{1, {2}},
+                  {2, {0, 2}},
+                  {2, {0, 0, 2}},
+                  {2, {0, 0, 0, 2}},
+                  {-1, {1}}},
+             Poly{{2, {1, 1}},
+                  {2, {0, 1, 1}},
+                  {2, {0, 0, 1, 1}},
+                  {-1, {0, 1}}},
+             Poly{{2, {1, 0, 1}},
+                  {1, {0, 2}},
+                  {2, {0, 1, 0, 1}},
+                  {-1, {0, 0, 1}}}});
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(
+                GroebnerAlgorithm::BuildGB(system, AutoReduction::Enabled));
+        }
+    }
+}  // namespace
+
+void BM_WeightedCompare(benchmark::State& state) {
+    RunPairs<Weighted>(state);
+}
+BENCHMARK(BM_WeightedCompare)->Arg(3)->Arg(8)->Arg(32);
+
+void BM_EliminationCompare(benchmark::State& state) {
+    RunPairs<Elimination>(state);
+}
+BENCHMARK(BM_EliminationCompare)->Arg(3)->Arg(8)->Arg(32);
+
+void BM_MatrixCompare(benchmark::State& state) {
+    RunPairs<Matrix>(state);
+}
+BENCHMARK(BM_MatrixCompare)->Arg(3)->Arg(8)->Arg(32);
+
+void BM_WeightedMultiply(benchmark::State& state) {
+    RunMultiply<Weighted>(state);
+}
+BENCHMARK(BM_WeightedMultiply)->Arg(100)->Arg(400);
+
+void BM_MatrixMultiply(benchmark::State& state) {
+    RunMultiply<Matrix>(state);
+}
+BENCHMARK(BM_MatrixMultiply)->Arg(100)->Arg(400);
+
+void BM_WeightedKatsura(benchmark::State& state) {
+    RunKatsura<Weighted>(state);
+}
+BENCHMARK(BM_WeightedKatsura);
+
+void BM_EliminationKatsura(benchmark::State& state) {
+    RunKatsura<Elimination>(state);
+}
+BENCHMARK(BM_EliminationKatsura);
+}  // namespace Groebner::Bench
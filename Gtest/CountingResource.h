@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace Groebner::Test {
+
+// counts bytes handed out by the resource; forwards to new/delete
+class CountingResource : public std::pmr::memory_resource {
+    public:
+        size_t allocated = 0;
+        size_t outstanding = 0;
+
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override {
+            allocated += bytes;
+            outstanding += bytes;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* ptr, size_t bytes,
+                           size_t alignment) override {
+            outstanding -= bytes;
+            std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+        }
+
+        bool do_is_equal(
+            const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+};
+
+}  // namespace Groebner::Test
@@ -0,0 +1,89 @@
+#include "Accumulator.h"
+#include "gtest/gtest.h"
+
+#include <random>
+
+namespace Groebner::Test {
+namespace {
+    template <IsSupportedField Field>
+    void CheckDotProduct(std::mt19937_64& gen, int64_t max_value,
+                         size_t size) {
+        std::uniform_int_distribution<int64_t> value(-max_value, max_value);
+        Details::Accumulator<Field> sum;
+        ASSERT_TRUE(sum.IsEmpty());
+        Field expected = 0;
+        for (size_t i = 0; i < size; i++) {
+            Field lhs = value(gen);
+            Field rhs = value(gen);
+            if (i % 3 == 0) {
+                sum.SubProduct(lhs, rhs);
+                expected -= lhs * rhs;
+            } else {
+                sum.AddProduct(lhs, rhs);
+                expected += lhs * rhs;
+            }
+            if (i % 7 == 0) {
+                sum.Add(lhs);
+                expected += lhs;
+            }
+        }
+        ASSERT_EQ(sum.Get(), expected);
+
+        sum.Clear();
+        ASSERT_TRUE(sum.IsEmpty());
+        ASSERT_TRUE(sum.Get().IsZero());
+    }
+}  // namespace
+
+TEST(Accumulator, DotProduct) {
+    std::mt19937_64 gen(45);
+    CheckDotProduct<Rational>(gen, 100, 100);
+    CheckDotProduct<BigRational>(gen, 1'000'000'000, 100);
+    CheckDotProduct<Modulo<13>>(gen, 100, 1000);
+    CheckDotProduct<Modulo<4294967291>>(gen, 1'000'000'000'000, 1000);
+}
+
+TEST(Accumulator, LargeModulus) {
+    // every product is close to 2^126, the sum is folded on the way
+    constexpr int64_t kPrime = 9223372036854775783;
+    using Field = Modulo<kPrime>;
+    std::mt19937_64 gen(46);
+    CheckDotProduct<Field>(gen, kPrime - 1, 10000);
+
+    Details::Accumulator<Field> sum;
+    Field max = kPrime - 1;
+    for (size_t i = 0; i < 100; i++) {
+        sum.AddProduct(max, max);
+    }
+    // (-1)^2 * 100
+    ASSERT_EQ(sum.Get(), Field(100));
+}
+
+TEST(Accumulator, NarrowModulus) {
+    // products close to 2^64, the 64-bit sum is reduced before every add
+    constexpr int64_t kPrime = 4294967291;
+    using Field = Modulo<kPrime>;
+    Details::Accumulator<Field> sum;
+    Field max = kPrime - 1;
+    for (size_t i = 0; i < 100; i++) {
+        sum.AddProduct(max, max);
+        sum.Add(max);
+    }
+    // 100 * ((-1)^2 - 1)
+    ASSERT_EQ(sum.Get(), Field(0));
+    sum.Add(max);
+    ASSERT_EQ(sum.Get(), max);
+}
+
+TEST(Accumulator, RuntimeModulo) {
+    std::mt19937_64 gen(47);
+    {
+        RuntimeModulo::Scope scope(1000003);
+        CheckDotProduct<RuntimeModulo>(gen, 1'000'000'000, 1000);
+    }
+    {
+        RuntimeModulo::Scope scope(9223372036854775783);
+        CheckDotProduct<RuntimeModulo>(gen, 9223372036854775782, 10000);
+    }
+}
+}  // namespace Groebner::Test
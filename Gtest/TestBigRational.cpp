@@ -0,0 +1,95 @@
+#include "BigRational.h"
+#include "GroebnerAlgorithm.h"
+#include "gtest/gtest.h"
+
+#include <limits>
+#include <random>
+
+namespace Groebner::Test {
+TEST(BigRationalBasic, Construction) {
+    static_assert(IsSupportedField<BigRational>);
+    ASSERT_DEATH(BigRational(3, 0), "Denominator must not be zero");
+    ASSERT_EQ(BigRational(2, 6), BigRational(1, 3));
+    ASSERT_EQ(BigRational(-4, -8), BigRational(1, 2));
+    ASSERT_EQ(BigRational(3, -2), BigRational(-3, 2));
+    ASSERT_EQ(BigRational(Rational(6, 4)), BigRational(3, 2));
+    ASSERT_EQ(BigRational(0, -5).GetDenominator(), Integer(1));
+
+    BigRational x(Integer("200000000000000000000"), Integer("-600000000000000000000"));
+    ASSERT_EQ(x, BigRational(-1, 3));
+    ASSERT_TRUE(x.GetNumerator().IsSmall());
+}
+
+TEST(BigRationalArithmetics, MatchesRational) {
+    std::mt19937 gen(41);
+    std::uniform_int_distribution<int64_t> value(-50, 50);
+    std::uniform_int_distribution<int64_t> positive(1, 50);
+    for (size_t i = 0; i < 1000; i++) {
+        Rational a(value(gen), positive(gen));
+        Rational b(value(gen), positive(gen));
+        BigRational x(a);
+        BigRational y(b);
+
+        ASSERT_EQ(x + y, BigRational(a + b));
+        ASSERT_EQ(x - y, BigRational(a - b));
+        ASSERT_EQ(x * y, BigRational(a * b));
+        ASSERT_EQ(x < y, a < b);
+        ASSERT_EQ(x.Abs(), BigRational(a.Abs()));
+        if (!b.IsZero()) {
+            ASSERT_EQ(x / y, BigRational(a / b));
+        }
+    }
+
+    BigRational z(3, 7);
+    z += z;
+    ASSERT_EQ(z, BigRational(6, 7));
+    z *= z;
+    ASSERT_EQ(z, BigRational(36, 49));
+    z /= z;
+    ASSERT_EQ(z, BigRational(1));
+    z -= z;
+    ASSERT_TRUE(z.IsZero());
+}
+
+TEST(BigRationalArithmetics, NoOverflow) {
+    constexpr int64_t kMax = std::numeric_limits<int64_t>::max();
+    BigRational x(kMax, kMax - 1);
+    BigRational y(1, kMax);
+    BigRational sum = x + y;
+    // (kMax^2 + kMax - 1) / (kMax (kMax - 1))
+    Integer big_max(kMax);
+    ASSERT_EQ(sum.GetNumerator(), big_max * big_max + big_max - 1);
+    ASSERT_EQ(sum.GetDenominator(), big_max * (big_max - 1));
+    ASSERT_EQ(sum - y, x);
+    ASSERT_TRUE((sum - y).GetDenominator().IsSmall());
+
+    BigRational power(1);
+    for (size_t i = 0; i < 10; i++) {
+        power *= BigRational(1000000007, 3);
+    }
+    for (size_t i = 0; i < 10; i++) {
+        power /= BigRational(1000000007, 3);
+    }
+    ASSERT_EQ(power, BigRational(1));
+    ASSERT_TRUE(BigRational(-1, 2) < BigRational(Integer(1), big_max * big_max));
+}
+
+TEST(BigRationalGroebner, LargeCoefficients) {
+    // x - 10^10, y - 10^10 x, the reduced basis needs 10^20 > int64 max
+    using Poly = Polynomial<BigRational, LexOrder>;
+    Poly f = {{1, {1}}, {-10'000'000'000, {}}};
+    Poly g = {{1, {0, 1}}, {-10'000'000'000, {1}}};
+    PolySystem<BigRational, LexOrder> system({f, g});
+
+    auto basis = GroebnerAlgorithm::BuildGB(system, AutoReduction::Enabled);
+
+    Poly expected = {{1, {0, 1}},
+                     {BigRational(Integer("-100000000000000000000")), {}}};
+    bool found = false;
+    for (size_t i = 0; i < basis.GetSize(); i++) {
+        found |= basis[i] == expected;
+    }
+    ASSERT_TRUE(found);
+    ASSERT_TRUE(GroebnerAlgorithm::IsInIdeal(expected, basis));
+}
+}  // namespace Groebner::Test
@@ -0,0 +1,113 @@
+#include "BitMatrix.h"
+#include "gtest/gtest.h"
+
+#include <random>
+#include <vector>
+
+namespace Groebner::Test {
+namespace {
+    using Rows = std::vector<std::vector<bool>>;
+
+    Rows ToRows(const BitMatrix& matrix) {
+        Rows rows(matrix.GetRowsCount(),
+                  std::vector<bool>(matrix.GetColsCount()));
+        for (size_t i = 0; i < matrix.GetRowsCount(); i++) {
+            for (size_t j = 0; j < matrix.GetColsCount(); j++) {
+                rows[i][j] = matrix.Get(i, j);
+            }
+        }
+        return rows;
+    }
+
+    // bit by bit Gauss-Jordan, the reduced row echelon form is unique
+    size_t EliminateNaive(Rows& rows) {
+        size_t rank = 0;
+        size_t cols = rows.empty() ? 0 : rows[0].size();
+        for (size_t col = 0; col < cols && rank < rows.size(); col++) {
+            size_t pivot = rank;
+            while (pivot < rows.size() && !rows[pivot][col]) {
+                pivot++;
+            }
+            if (pivot == rows.size()) {
+                continue;
+            }
+            std::swap(rows[rank], rows[pivot]);
+            for (size_t row = 0; row < rows.size(); row++) {
+                if (row != rank && rows[row][col]) {
+                    for (size_t j = 0; j < cols; j++) {
+                        rows[row][j] = rows[row][j] != rows[rank][j];
+                    }
+                }
+            }
+            rank++;
+        }
+        return rank;
+    }
+}  // namespace
+
+TEST(BitMatrix, Basic) {
+    BitMatrix matrix(2, 70);
+    ASSERT_EQ(matrix.GetRowsCount(), 2);
+    ASSERT_EQ(matrix.GetColsCount(), 70);
+    ASSERT_EQ(matrix.GetRow(0).size(), 2);
+    ASSERT_EQ(matrix.FindPivot(0), 70);
+
+    matrix.Set(0, 69, true);
+    matrix.Set(0, 3, true);
+    matrix.Flip(1, 3);
+    ASSERT_TRUE(matrix.Get(0, 69));
+    ASSERT_TRUE(matrix.Get(1, 3));
+    ASSERT_FALSE(matrix.Get(1, 69));
+    ASSERT_EQ(matrix.FindPivot(0), 3);
+
+    matrix.AddRow(0, 1);
+    ASSERT_FALSE(matrix.Get(0, 3));
+    ASSERT_EQ(matrix.FindPivot(0), 69);
+
+    matrix.SwapRows(0, 1);
+    ASSERT_EQ(matrix.FindPivot(0), 3);
+    ASSERT_EQ(matrix.FindPivot(1), 69);
+
+    matrix.Set(1, 69, false);
+    ASSERT_EQ(matrix.FindPivot(1), 70);
+    ASSERT_DEATH(matrix.AddRow(0, 0), "Row would be cleared");
+}
+
+TEST(BitMatrix, Eliminate) {
+    std::mt19937_64 gen(47);
+    for (auto [rows_count, cols_count] :
+         std::vector<std::pair<size_t, size_t>>{
+             {0, 0}, {1, 1}, {5, 3}, {3, 5}, {64, 64}, {40, 130}, {130, 40}}) {
+        for (int density : {2, 10}) {
+            BitMatrix matrix(rows_count, cols_count);
+            for (size_t i = 0; i < rows_count; i++) {
+                for (size_t j = 0; j < cols_count; j++) {
+                    matrix.Set(i, j, gen() % density == 0);
+                }
+            }
+            Rows expected = ToRows(matrix);
+            size_t expected_rank = EliminateNaive(expected);
+
+            ASSERT_EQ(matrix.Eliminate(), expected_rank);
+            ASSERT_EQ(ToRows(matrix), expected);
+            for (size_t i = 1; i < expected_rank; i++) {
+                ASSERT_LT(matrix.FindPivot(i - 1), matrix.FindPivot(i));
+            }
+        }
+    }
+
+    // full rank square matrix becomes the identity
+    BitMatrix matrix(100, 100);
+    for (size_t i = 0; i < 100; i++) {
+        for (size_t j = i; j < 100; j++) {
+            matrix.Set(i, j, true);
+        }
+    }
+    ASSERT_EQ(matrix.Eliminate(), 100);
+    for (size_t i = 0; i < 100; i++) {
+        for (size_t j = 0; j < 100; j++) {
+            ASSERT_EQ(matrix.Get(i, j), i == j);
+        }
+    }
+}
+}  // namespace Groebner::Test
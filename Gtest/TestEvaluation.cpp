@@ -0,0 +1,101 @@
+#include "Evaluation.h"
+#include "gtest/gtest.h"
+
+#include <random>
+
+namespace Groebner::Test {
+namespace {
+    template <IsSupportedField Field>
+    std::vector<std::vector<Field>> RandomPoints(std::mt19937& gen,
+                                                 size_t vars, size_t count) {
+        std::uniform_int_distribution<int> value(-10, 10);
+        std::vector<std::vector<Field>> result(count);
+        for (auto& point : result) {
+            for (size_t var = 0; var < vars; var++) {
+                point.push_back(value(gen));
+            }
+        }
+        return result;
+    }
+}  // namespace
+
+TEST(Evaluation, PointBatch) {
+    PointBatch<Rational> batch({{1, 2}, {3}, {4, 5, 6}});
+    ASSERT_EQ(batch.GetVarsCount(), 3);
+    ASSERT_EQ(batch.GetSize(), 3);
+    std::vector<Rational> first = {1, 3, 4};
+    std::vector<Rational> point = {3, 0, 0};
+    ASSERT_TRUE(std::equal(first.begin(), first.end(),
+                           batch.GetVariable(0).begin()));
+    ASSERT_EQ(batch.GetPoint(1), point);
+
+    batch.GetVariable(2)[1] = 7;
+    point[2] = 7;
+    ASSERT_EQ(batch.GetPoint(1), point);
+}
+
+TEST(Evaluation, Polynomial) {
+    // x^2 y - 3 z + 1/2
+    Polynomial<Rational> poly = {
+        {1, {2, 1}}, {-3, {0, 0, 1}}, {Rational(1, 2), {}}};
+    PointBatch<Rational> batch({{1, 2, 3}, {0, 0, 0}, {-2, Rational(1, 3), 1}});
+    std::vector<Rational> expected = {Rational(-13, 2), Rational(1, 2),
+                                      Rational(-7, 6)};
+    ASSERT_EQ(Evaluate(poly, batch), expected);
+
+    std::vector<Rational> point = {1, 2, 3};
+    ASSERT_EQ(Evaluate(poly, std::span<const Rational>(point)), expected[0]);
+
+    Polynomial<Rational> zero;
+    ASSERT_EQ(Evaluate(zero, batch), std::vector<Rational>(3));
+}
+
+TEST(Evaluation, SparseDegrees) {
+    // only the exponents that occur are tabulated, x^1000000 takes one row
+    Polynomial<Rational> poly = {
+        {1, {1000000}}, {2, {999999, 1}}, {1, {3}}, {-1, {0, 40}}};
+    PointBatch<Rational> batch({{1, 2}, {-1, 1}, {0, -1}, {-1, 2}});
+    int64_t power = int64_t(1) << 40;
+    std::vector<Rational> expected = {6 - power, -3, -1, -4 - power};
+    ASSERT_EQ(Evaluate(poly, batch), expected);
+
+    std::vector<Rational> point = {-1, 2};
+    ASSERT_EQ(Evaluate(poly, std::span<const Rational>(point)), expected[3]);
+
+    // x^(p - 1) = 1 for x != 0
+    Polynomial<Modulo<101>> fermat = {{1, {100 * 12345}}};
+    PointBatch<Modulo<101>> values({{0}, {1}, {5}, {100}});
+    std::vector<Modulo<101>> ones = {0, 1, 1, 1};
+    ASSERT_EQ(Evaluate(fermat, values), ones);
+}
+
+TEST(Evaluation, MatchesSinglePoint) {
+    using Field = Modulo<101>;
+    std::mt19937 gen(40);
+    std::uniform_int_distribution<int> coef(0, 100);
+    std::uniform_int_distribution<Monomial::DegreeType> degree(0, 6);
+
+    PolySystem<Field, GrevlexOrder> system;
+    for (size_t i = 0; i < 3; i++) {
+        std::vector<ModuloTerm<101>> terms;
+        for (size_t j = 0; j < 30; j++) {
+            terms.push_back(
+                {coef(gen), {degree(gen), degree(gen), degree(gen), degree(gen)}});
+        }
+        system.Add(Polynomial<Field, GrevlexOrder>(std::move(terms)));
+    }
+
+    // more than one block of points
+    auto points = RandomPoints<Field>(gen, 4, 1000);
+    PointBatch<Field> batch(points);
+    auto values = Evaluate(system, batch);
+    ASSERT_EQ(values.size(), system.GetSize());
+    for (size_t i = 0; i < system.GetSize(); i++) {
+        ASSERT_EQ(Evaluate(system[i], batch), values[i]);
+        for (size_t j = 0; j < points.size(); j++) {
+            ASSERT_EQ(Evaluate(system[i], std::span<const Field>(points[j])),
+                      values[i][j]);
+        }
+    }
+}
+}  // namespace Groebner::Test
@@ -0,0 +1,178 @@
+#include "GroebnerAlgorithm.h"
+#include "gtest/gtest.h"
+
+#include <random>
+
+namespace Groebner::Test {
+namespace {
+    template <IsSupportedField Field>
+    PolySystem<Field, GrevlexOrder> MakeSystem(std::mt19937_64& gen,
+                                               size_t size) {
+        std::uniform_int_distribution<int64_t> coef(-9, 9);
+        PolySystem<Field, GrevlexOrder> system;
+        for (size_t i = 0; i < size; i++) {
+            std::vector<Term<Field>> terms;
+            for (size_t j = 0; j < 4; j++) {
+                terms.push_back({Field(coef(gen), 1 + gen() % 3),
+                                 {gen() % 3, gen() % 3, gen() % 2}});
+            }
+            system.Add(Polynomial<Field, GrevlexOrder>(std::move(terms)));
+        }
+        return system;
+    }
+
+    template <IsSupportedField Field, IsComparator Comparator>
+    void CheckPrimitive(const Polynomial<Field, Comparator>& poly) {
+        ASSERT_FALSE(poly.IsZero());
+        for (const auto& [degree, coef] : poly) {
+            ASSERT_EQ(coef.GetDenominator(), 1);
+        }
+        ASSERT_EQ(Details::GetContent(poly), 1);
+        ASSERT_GT(poly.GetLeaderCoef(), Field(0));
+    }
+
+    template <IsSupportedField Field>
+    void CheckSameBasis(std::mt19937_64& gen) {
+        for (size_t test = 0; test < 3; test++) {
+            auto system = MakeSystem<Field>(gen, 2 + test % 2);
+            auto expected =
+                GroebnerAlgorithm::BuildGB(system, AutoReduction::Enabled);
+            auto reduced = GroebnerAlgorithm::BuildGB(
+                system, AutoReduction::Enabled, CoefficientMode::FractionFree);
+            ASSERT_EQ(reduced.GetSize(), expected.GetSize());
+            for (size_t i = 0; i < reduced.GetSize(); i++) {
+                ASSERT_EQ(reduced[i], expected[i]);
+            }
+
+            auto basis = GroebnerAlgorithm::BuildGB(
+                system, AutoReduction::Disabled,
+                CoefficientMode::FractionFree);
+            // both are bases of the same ideal
+            for (size_t i = 0; i < basis.GetSize(); i++) {
+                CheckPrimitive(basis[i]);
+                ASSERT_TRUE(GroebnerAlgorithm::ReducePolynomial(basis[i],
+                                                                expected)
+                                .IsZero());
+            }
+            for (size_t i = 0; i < expected.GetSize(); i++) {
+                ASSERT_TRUE(
+                    GroebnerAlgorithm::ReducePolynomial(expected[i], basis)
+                        .IsZero());
+            }
+        }
+    }
+}  // namespace
+
+TEST(FractionFree, MakePrimitive) {
+    // 1/2 x^2 - 3/4 y + 3/2 -> 2 x^2 - 3 y + 6
+    Polynomial<Rational> poly{{{1, 2}, {2}}, {{-3, 4}, {0, 1}}, {{3, 2}, {}}};
+    Details::MakePrimitive(poly);
+    ASSERT_EQ(poly, Polynomial<Rational>({{2, {2}}, {-3, {0, 1}}, {6, {}}}));
+    ASSERT_EQ(Details::GetContent(poly), 1);
+
+    Polynomial<Rational> negative{{-6, {1}}, {4, {}}};
+    ASSERT_EQ(Details::GetContent(negative), 2);
+    Details::MakePrimitive(negative);
+    ASSERT_EQ(negative, Polynomial<Rational>({{3, {1}}, {-2, {}}}));
+
+    Polynomial<BigRational> big{{BigRational(Integer("1000000000000000000000"),
+                                             Integer(3)),
+                                 {1}},
+                                {BigRational(Integer("2000000000000000000000"),
+                                             Integer(7)),
+                                 {}}};
+    Details::MakePrimitive(big);
+    ASSERT_EQ(big, Polynomial<BigRational>({{7, {1}}, {6, {}}}));
+
+    Polynomial<Rational> zero;
+    Details::MakePrimitive(zero);
+    ASSERT_TRUE(zero.IsZero());
+}
+
+TEST(FractionFree, PseudoRemainder) {
+    std::mt19937_64 gen(49);
+    for (size_t test = 0; test < 20; test++) {
+        auto system = MakeSystem<Rational>(gen, 3);
+        for (size_t i = 0; i < system.GetSize(); i++) {
+            Details::MakePrimitive(system[i]);
+        }
+        auto poly = MakeSystem<Rational>(gen, 1)[0];
+
+        // the same reducers are chosen, the remainders are proportional
+        auto expected = GroebnerAlgorithm::ReducePolynomial(poly, system);
+        auto rem = GroebnerAlgorithm::ReducePolynomial(
+            poly, system, CoefficientMode::FractionFree);
+        ASSERT_EQ(rem.IsZero(), expected.IsZero());
+        if (rem.IsZero()) {
+            continue;
+        }
+        CheckPrimitive(rem);
+        rem.ReduceByLeaderCoef();
+        expected.ReduceByLeaderCoef();
+        ASSERT_EQ(rem, expected);
+    }
+}
+
+TEST(FractionFree, NonIntegerReducers) {
+    // a monic basis from Fractions mode has non-integer coefficients
+    std::mt19937_64 gen(51);
+    for (size_t test = 0; test < 5; test++) {
+        auto system = MakeSystem<BigRational>(gen, 2);
+        auto basis =
+            GroebnerAlgorithm::BuildGB(system, AutoReduction::Enabled);
+        auto poly = MakeSystem<BigRational>(gen, 1)[0];
+
+        auto expected = GroebnerAlgorithm::ReducePolynomial(poly, basis);
+        auto rem = GroebnerAlgorithm::ReducePolynomial(
+            poly, basis, CoefficientMode::FractionFree);
+        ASSERT_EQ(rem.IsZero(), expected.IsZero());
+        if (!rem.IsZero()) {
+            CheckPrimitive(rem);
+            rem.ReduceByLeaderCoef();
+            expected.ReduceByLeaderCoef();
+            ASSERT_EQ(rem, expected);
+        }
+
+        auto unreduced = GroebnerAlgorithm::BuildGB(system);
+        auto reduced = unreduced;
+        GroebnerAlgorithm::ReduceBasisInplace(unreduced,
+                                              CoefficientMode::FractionFree);
+        GroebnerAlgorithm::ReduceBasisInplace(reduced);
+        ASSERT_EQ(unreduced.GetSize(), reduced.GetSize());
+        for (size_t i = 0; i < reduced.GetSize(); i++) {
+            ASSERT_EQ(unreduced[i], reduced[i]);
+        }
+    }
+}
+
+TEST(FractionFree, Basis) {
+    // the unreduced basis of BasisBuild.Advanced with integers
+    Polynomial<Rational, LexOrder> x{{1, {2, 0}}, {1, {1, 1}}, {1, {0, 0}}};
+    Polynomial<Rational, LexOrder> y{{1, {1, 1}}, {-1, {0, 2}}};
+    auto basis =
+        GroebnerAlgorithm::BuildGB(PolySystem<Rational, LexOrder>({x, y}),
+                                   AutoReduction::Disabled,
+                                   CoefficientMode::FractionFree);
+    ASSERT_EQ(basis.GetSize(), 3);
+    Polynomial<Rational, LexOrder> z{{2, {0, 3}}, {1, {0, 1}}};
+    ASSERT_EQ(basis[2], z);
+
+    auto reduced =
+        GroebnerAlgorithm::BuildGB(PolySystem<Rational, LexOrder>({x, y}),
+                                   AutoReduction::Enabled,
+                                   CoefficientMode::FractionFree);
+    Polynomial<Rational, LexOrder> monic{{1, {0, 3}}, {{1, 2}, {0, 1}}};
+    ASSERT_EQ(reduced[2], monic);
+
+    // random systems outgrow int64_t
+    std::mt19937_64 gen(50);
+    CheckSameBasis<BigRational>(gen);
+
+    // other fields ignore the mode
+    PolySystem<Modulo<7>, LexOrder> modulo(
+        {Polynomial<Modulo<7>, LexOrder>{{3, {1}}, {1, {}}}});
+    auto same = GroebnerAlgorithm::BuildGB(modulo, AutoReduction::Disabled,
+                                           CoefficientMode::FractionFree);
+    ASSERT_EQ(same[0], modulo[0]);
+}
+}  // namespace Groebner::Test
@@ -0,0 +1,189 @@
+#include "GroebnerAlgorithm.h"
+#include "gtest/gtest.h"
+
+#include <random>
+#include <vector>
+
+namespace Groebner::Test {
+namespace {
+    template <typename Field>
+    std::vector<Field> GetAllElements() {
+        constexpr int64_t kP = Field::GetCharacteristic();
+        constexpr size_t kK = Field::GetDegree();
+        std::vector<Field> elements;
+        std::vector<int64_t> coefs(kK);
+        while (true) {
+            elements.push_back(Field::FromCoefficients(coefs));
+            size_t i = 0;
+            while (i < kK && ++coefs[i] == kP) {
+                coefs[i++] = 0;
+            }
+            if (i == kK) {
+                return elements;
+            }
+        }
+    }
+
+    template <typename Field>
+    std::vector<Field> GetRandomElements(std::mt19937_64& gen, size_t count) {
+        std::uniform_int_distribution<int64_t> coef(
+            0, Field::GetCharacteristic() - 1);
+        std::vector<Field> elements = {0, 1, -1, Field::GetRoot()};
+        while (elements.size() < count) {
+            std::vector<int64_t> coefs(Field::GetDegree());
+            for (auto& c : coefs) {
+                c = coef(gen);
+            }
+            elements.push_back(Field::FromCoefficients(coefs));
+        }
+        return elements;
+    }
+
+    template <typename Field>
+    void CheckAxioms(const std::vector<Field>& elements) {
+        for (const Field& a : elements) {
+            ASSERT_EQ(a + Field(), a);
+            ASSERT_EQ(a * Field(1), a);
+            ASSERT_TRUE((a + -a).IsZero());
+            ASSERT_TRUE((a - a).IsZero());
+            if (!a.IsZero()) {
+                ASSERT_EQ(a * (Field(1) / a), Field(1));
+            }
+            for (const Field& b : elements) {
+                ASSERT_EQ(a + b, b + a);
+                ASSERT_EQ(a * b, b * a);
+                ASSERT_EQ(a - b + b, a);
+                if (!b.IsZero()) {
+                    ASSERT_EQ(a / b * b, a);
+                }
+                const Field& c = elements[(&b - elements.data()) * 7 %
+                                          elements.size()];
+                ASSERT_EQ((a + b) * c, a * c + b * c);
+                ASSERT_EQ((a * b) * c, a * (b * c));
+                ASSERT_EQ((a + b) + c, a + (b + c));
+            }
+        }
+    }
+
+    // the root satisfies the defining polynomial
+    template <typename Field>
+    void CheckRoot() {
+        const auto& modulus = Field::GetDefiningPolynomial();
+        ASSERT_EQ(modulus.size(), Field::GetDegree() + 1);
+        ASSERT_EQ(modulus.back(), 1);
+        Field sum, power = 1;
+        for (int64_t coef : modulus) {
+            sum += Field(coef) * power;
+            power *= Field::GetRoot();
+        }
+        ASSERT_TRUE(sum.IsZero());
+    }
+}  // namespace
+
+TEST(GaloisField, Basic) {
+    using F = GaloisField<3, 2>;
+    ASSERT_EQ(F(5), F(2));
+    ASSERT_EQ(F(-1), F(2));
+    ASSERT_EQ(F(5).GetCoefficient(0), 2);
+    ASSERT_EQ(F(5).GetCoefficient(1), 0);
+    ASSERT_TRUE(F(3).IsZero());
+
+    std::vector<int64_t> coefs = {1, 2};
+    F x = F::FromCoefficients(coefs);
+    ASSERT_EQ(x.GetCoefficient(0), 1);
+    ASSERT_EQ(x.GetCoefficient(1), 2);
+    ASSERT_EQ(x, F(1) + F(2) * F::GetRoot());
+    ASSERT_DEATH(F(1) / F(), "Can't divide by zero");
+
+    // GF(4) has the single defining polynomial x^2 + x + 1
+    using G = GaloisField<2, 2>;
+    ASSERT_EQ(G::GetDefiningPolynomial(),
+              Details::FieldPolynomial({1, 1, 1}));
+    G alpha = G::GetRoot();
+    ASSERT_EQ(alpha * alpha, alpha + 1);
+}
+
+TEST(GaloisField, TabulatedFields) {
+    CheckAxioms(GetAllElements<GaloisField<2, 1>>());
+    CheckAxioms(GetAllElements<GaloisField<2, 2>>());
+    CheckAxioms(GetAllElements<GaloisField<2, 4>>());
+    CheckAxioms(GetAllElements<GaloisField<3, 2>>());
+    CheckAxioms(GetAllElements<GaloisField<5, 3>>());
+    CheckAxioms(GetAllElements<GaloisField<7, 1>>());
+    CheckRoot<GaloisField<2, 4>>();
+    CheckRoot<GaloisField<3, 4>>();
+    CheckRoot<GaloisField<2, 16>>();
+    CheckRoot<GaloisField<251, 2>>();
+
+    // every non-zero element has order dividing q - 1
+    using F = GaloisField<3, 3>;
+    for (const F& a : GetAllElements<F>()) {
+        if (a.IsZero()) {
+            continue;
+        }
+        F power = 1;
+        for (size_t i = 0; i < 26; i++) {
+            power *= a;
+        }
+        ASSERT_EQ(power, F(1));
+    }
+}
+
+TEST(GaloisField, PolynomialBasis) {
+    std::mt19937_64 gen(48);
+    CheckAxioms(GetRandomElements<GaloisField<2, 20>>(gen, 60));
+    CheckAxioms(GetRandomElements<GaloisField<65537, 2>>(gen, 60));
+    CheckAxioms(GetRandomElements<GaloisField<1000000007, 3>>(gen, 60));
+    CheckAxioms(
+        GetRandomElements<GaloisField<2305843009213693951, 4>>(gen, 30));
+    CheckAxioms(GetRandomElements<GaloisField<1000003, 1>>(gen, 60));
+    CheckRoot<GaloisField<2, 20>>();
+    CheckRoot<GaloisField<65537, 2>>();
+    CheckRoot<GaloisField<1000000007, 3>>();
+    CheckRoot<GaloisField<2305843009213693951, 4>>();
+
+    // Frobenius: (a + b)^p = a^p + b^p
+    using F = GaloisField<65537, 3>;
+    auto power = [](F base) {
+        F result = 1;
+        for (int64_t exponent = F::GetCharacteristic(); exponent > 0;
+             exponent >>= 1) {
+            if (exponent & 1) {
+                result *= base;
+            }
+            base *= base;
+        }
+        return result;
+    };
+    auto elements = GetRandomElements<F>(gen, 20);
+    for (const F& a : elements) {
+        for (const F& b : elements) {
+            ASSERT_EQ(power(a + b), power(a) + power(b));
+        }
+    }
+}
+
+TEST(GaloisField, GroebnerBasis) {
+    // x^2 + x + 1 splits over GF(4) as (x + alpha)(x + alpha + 1)
+    using F = GaloisField<2, 2>;
+    F alpha = F::GetRoot();
+    Polynomial<F> poly{{1, {2}}, {1, {1}}, {1, {}}};
+
+    PolySystem<F, LexOrder> split({poly, Polynomial<F>{{1, {1}}, {alpha, {}}}});
+    auto basis = GroebnerAlgorithm::BuildGB(split, AutoReduction::Enabled);
+    ASSERT_EQ(basis.GetSize(), 1);
+    ASSERT_EQ(basis[0], Polynomial<F>({{1, {1}}, {alpha, {}}}));
+
+    // 1 is not a root, the ideal is everything
+    PolySystem<F, LexOrder> full({poly, Polynomial<F>{{1, {1}}, {1, {}}}});
+    basis = GroebnerAlgorithm::BuildGB(full, AutoReduction::Enabled);
+    ASSERT_EQ(basis.GetSize(), 1);
+    ASSERT_EQ(basis[0], Polynomial<F>({{1, {}}}));
+
+    // x = alpha, y = 1 / alpha is a common zero, x + alpha + 1 is not zero
+    ASSERT_FALSE(GroebnerAlgorithm::IsInIdeal(
+        Polynomial<F>{{1, {1}}, {alpha + 1, {}}},
+        PolySystem<F, LexOrder>(
+            {poly, Polynomial<F>{{1, {1, 1}}, {1, {}}}})));
+}
+}  // namespace Groebner::Test
@@ -0,0 +1,132 @@
+#include "GroebnerAlgorithm.h"
+#include "Gf2System.h"
+#include "gtest/gtest.h"
+
+#include <random>
+
+namespace Groebner::Test {
+namespace {
+    template <IsComparator Comparator>
+    Polynomial<Modulo<2>, Comparator> ToModulo(
+        const Polynomial<Gf2, Comparator>& poly) {
+        std::vector<Term<Modulo<2>>> terms;
+        for (const auto& [degree, coef] : poly) {
+            terms.push_back({coef.GetValue(), degree});
+        }
+        return Polynomial<Modulo<2>, Comparator>(std::move(terms));
+    }
+
+    Polynomial<Gf2, GrevlexOrder> MakeRandom(std::mt19937_64& gen,
+                                             size_t vars_count) {
+        std::vector<Term<Gf2>> terms;
+        for (size_t i = 0; i < 5; i++) {
+            Monomial degree(vars_count);
+            for (size_t j = 0; j < vars_count; j++) {
+                degree.SetDegree(j, gen() % 3);
+            }
+            terms.push_back({1, std::move(degree)});
+        }
+        return Polynomial<Gf2, GrevlexOrder>(std::move(terms));
+    }
+}  // namespace
+
+TEST(Gf2, Arithmetic) {
+    Gf2 zero;
+    Gf2 one(1);
+    ASSERT_TRUE(zero.IsZero());
+    ASSERT_EQ(Gf2(2), zero);
+    ASSERT_EQ(Gf2(-1), one);
+    ASSERT_EQ(Gf2(-4), zero);
+
+    ASSERT_EQ(one + one, zero);
+    ASSERT_EQ(one - one, zero);
+    ASSERT_EQ(zero - one, one);
+    ASSERT_EQ(-one, one);
+    ASSERT_EQ(one * one, one);
+    ASSERT_EQ(one * zero, zero);
+    ASSERT_EQ(one / one, one);
+    ASSERT_EQ(zero / one, zero);
+    ASSERT_DEATH(one / zero, "Can't divide by zero");
+
+    ASSERT_LT(zero, one);
+    ASSERT_GE(one, zero);
+    ASSERT_NE(one, zero);
+}
+
+TEST(Gf2, SameBasisAsModulo2) {
+    std::mt19937_64 gen(47);
+    for (size_t test = 0; test < 5; test++) {
+        PolySystem<Gf2, GrevlexOrder> system;
+        PolySystem<Modulo<2>, GrevlexOrder> expected_system;
+        for (size_t i = 0; i < 3; i++) {
+            auto poly = MakeRandom(gen, 3);
+            expected_system.Add(ToModulo(poly));
+            system.Add(std::move(poly));
+        }
+        auto basis = GroebnerAlgorithm::BuildGB(system, AutoReduction::Enabled);
+        auto expected = GroebnerAlgorithm::BuildGB(expected_system,
+                                                   AutoReduction::Enabled);
+        ASSERT_EQ(basis.GetSize(), expected.GetSize());
+        for (size_t i = 0; i < basis.GetSize(); i++) {
+            ASSERT_EQ(ToModulo(basis[i]), expected[i]);
+        }
+    }
+}
+
+TEST(Gf2, FieldEquations) {
+    // x^3 y + x y^2 + x y + 1 = 1 for Boolean x and y
+    Polynomial<Gf2> poly{{1, {3, 1}}, {1, {1, 2}}, {1, {1, 1}}, {1, {}}};
+    Polynomial<Gf2> expected{{1, {1, 1}}, {1, {}}};
+    ASSERT_EQ(ApplyFieldEquations(poly), expected);
+
+    PolySystem<Gf2, LexOrder> system;
+    AddFieldEquations(system, 2);
+    ASSERT_EQ(system.GetSize(), 2);
+    ASSERT_EQ(system[1], Polynomial<Gf2>({{1, {0, 2}}, {1, {0, 1}}}));
+    for (size_t i = 0; i < system.GetSize(); i++) {
+        ASSERT_TRUE(ApplyFieldEquations(system[i]).IsZero());
+    }
+
+    // x y = 1 with field equations forces x = y = 1
+    system.Add(Polynomial<Gf2>{{1, {1, 1}}, {1, {}}});
+    auto basis = GroebnerAlgorithm::BuildGB(system, AutoReduction::Enabled);
+    ASSERT_TRUE(GroebnerAlgorithm::IsInIdeal(
+        Polynomial<Gf2>{{1, {1}}, {1, {}}}, basis));
+    ASSERT_TRUE(GroebnerAlgorithm::IsInIdeal(
+        Polynomial<Gf2>{{1, {0, 1}}, {1, {}}}, basis));
+}
+
+TEST(Gf2, ReduceLinear) {
+    // x + y, y + 1, x + 1 span {x + 1, y + 1}
+    PolySystem<Gf2, LexOrder> system({Polynomial<Gf2>{{1, {1}}, {1, {0, 1}}},
+                            Polynomial<Gf2>{{1, {0, 1}}, {1, {}}},
+                            Polynomial<Gf2>{{1, {1}}, {1, {}}}});
+    auto reduced = ReduceLinear(system);
+    ASSERT_EQ(reduced.GetSize(), 2);
+    ASSERT_EQ(reduced[0], Polynomial<Gf2>({{1, {1}}, {1, {}}}));
+    ASSERT_EQ(reduced[1], Polynomial<Gf2>({{1, {0, 1}}, {1, {}}}));
+
+    std::mt19937_64 gen(48);
+    PolySystem<Gf2, GrevlexOrder> random;
+    for (size_t i = 0; i < 20; i++) {
+        random.Add(MakeRandom(gen, 4));
+    }
+    auto echelon = ReduceLinear(random);
+    ASSERT_LE(echelon.GetSize(), random.GetSize());
+    for (size_t i = 0; i < echelon.GetSize(); i++) {
+        for (size_t j = 0; j < echelon.GetSize(); j++) {
+            if (i != j) {
+                ASSERT_FALSE(echelon[j].IsLeaderDivisibleBy(echelon[i]) &&
+                             echelon[j].GetLeaderDegree() ==
+                                 echelon[i].GetLeaderDegree());
+            }
+        }
+    }
+    // the echelon form is its own reduced form
+    auto again = ReduceLinear(echelon);
+    ASSERT_EQ(again.GetSize(), echelon.GetSize());
+    for (size_t i = 0; i < again.GetSize(); i++) {
+        ASSERT_EQ(again[i], echelon[i]);
+    }
+}
+}  // namespace Groebner::Test
@@ -1,6 +1,9 @@
+#include "CountingResource.h"
 #include "GroebnerAlgorithm.h"
 #include "gtest/gtest.h"
 
+#include <memory_resource>
+
 namespace Groebner::Test {
 
 template <IsSupportedField Field, IsComparator Comparator>
@@ -501,6 +504,35 @@ TEST(BasisBuild, Advanced) {
     // TODO add example with another degree ordering and with modulo field
 }
 
+TEST(BasisBuild, MemoryResource) {
+    Polynomial<Rational, LexOrder> x{{1, {2, 0}}, {1, {1, 1}}, {1, {0, 0}}};
+    Polynomial<Rational, LexOrder> y{{1, {1, 1}}, {-1, {0, 2}}};
+
+    Polynomial<Rational, LexOrder> x1{{1, {2, 0}}, {1, {0, 2}}, {1, {0, 0}}};
+    Polynomial<Rational, LexOrder> y1{{1, {1, 1}}, {-1, {0, 2}}};
+    Polynomial<Rational, LexOrder> z1{{1, {0, 3}}, {{1, 2}, {0, 1}}};
+    PolySystem<Rational, LexOrder> expected({x1, y1, z1});
+
+    CountingResource arena_upstream;
+    CountingResource result_resource;
+    {
+        PolySystem<Rational, LexOrder> basis({x, y}, &result_resource);
+        ASSERT_EQ(basis[0].GetResource(), &result_resource);
+
+        GroebnerAlgorithm::BuildGBInplace(basis, AutoReduction::Enabled,
+                                          &arena_upstream);
+        CheckEqual(basis, expected);
+        ASSERT_EQ(basis.GetResource(), &result_resource);
+        for (size_t i = 0; i < basis.GetSize(); i++) {
+            ASSERT_EQ(basis[i].GetResource(), &result_resource);
+        }
+
+        ASSERT_GT(arena_upstream.allocated, 0);
+        ASSERT_EQ(arena_upstream.outstanding, 0);
+    }
+    ASSERT_EQ(result_resource.outstanding, 0);
+}
+
 TEST(IsInIdeal, Basic) {
     {
         Polynomial<Rational, LexOrder> x{{1, {1}}};
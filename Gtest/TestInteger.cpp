@@ -0,0 +1,165 @@
+#include "Integer.h"
+#include "gtest/gtest.h"
+
+#include <limits>
+#include <random>
+
+namespace Groebner::Test {
+namespace {
+    using Wide = __int128;
+
+    std::string ToString(Wide value) {
+        if (value == 0) {
+            return "0";
+        }
+        bool is_negative = value < 0;
+        unsigned __int128 magnitude =
+            is_negative ? -static_cast<unsigned __int128>(value) : value;
+        std::string result;
+        while (magnitude > 0) {
+            result.insert(result.begin(), '0' + magnitude % 10);
+            magnitude /= 10;
+        }
+        return is_negative ? "-" + result : result;
+    }
+
+    Integer FromWide(Wide value) { return Integer(ToString(value)); }
+
+    constexpr int64_t kMax = std::numeric_limits<int64_t>::max();
+    constexpr int64_t kMin = std::numeric_limits<int64_t>::min();
+}  // namespace
+
+TEST(IntegerBasic, Construction) {
+    ASSERT_TRUE(Integer().IsZero());
+    ASSERT_TRUE(Integer(5).IsSmall());
+    ASSERT_EQ(Integer("-123"), Integer(-123));
+    ASSERT_EQ(Integer("+0"), Integer());
+    ASSERT_EQ(Integer("9223372036854775807"), Integer(kMax));
+    ASSERT_EQ(Integer("-9223372036854775808"), Integer(kMin));
+    ASSERT_TRUE(Integer("-9223372036854775808").IsSmall());
+    ASSERT_FALSE(Integer("9223372036854775808").IsSmall());
+
+    std::string big = "-123456789012345678901234567890123456789";
+    ASSERT_EQ(Integer(big).ToString(), big);
+    ASSERT_EQ(Integer(kMin).ToString(), "-9223372036854775808");
+    ASSERT_EQ(Integer("1000000000000000000000").ToString(),
+              "1000000000000000000000");
+}
+
+TEST(IntegerBasic, Sign) {
+    ASSERT_EQ(Integer().GetSign(), 0);
+    ASSERT_EQ(Integer(-3).GetSign(), -1);
+    ASSERT_EQ(Integer("99999999999999999999").GetSign(), 1);
+    ASSERT_EQ(Integer("-99999999999999999999").GetSign(), -1);
+    ASSERT_EQ(Integer("-99999999999999999999").Abs(),
+              Integer("99999999999999999999"));
+
+    Integer min(kMin);
+    ASSERT_FALSE((-min).IsSmall());
+    ASSERT_EQ(-min, Integer("9223372036854775808"));
+    ASSERT_TRUE((-(-min)).IsSmall());
+    ASSERT_EQ(-(-min), min);
+}
+
+TEST(IntegerArithmetics, Overflow) {
+    Integer x(kMax);
+    x += 1;
+    ASSERT_FALSE(x.IsSmall());
+    ASSERT_EQ(x.ToString(), "9223372036854775808");
+    x -= 1;
+    ASSERT_TRUE(x.IsSmall());
+    ASSERT_EQ(x, Integer(kMax));
+
+    Integer y(kMax);
+    y *= kMax;
+    ASSERT_EQ(y.ToString(), "85070591730234615847396907784232501249");
+    y /= kMax;
+    ASSERT_TRUE(y.IsSmall());
+    ASSERT_EQ(y, Integer(kMax));
+
+    Integer z(kMin);
+    z /= -1;
+    ASSERT_EQ(z, Integer("9223372036854775808"));
+    ASSERT_EQ(Integer(kMin) % Integer(-1), Integer());
+}
+
+TEST(IntegerArithmetics, MatchesWide) {
+    std::mt19937_64 gen(41);
+    std::uniform_int_distribution<int64_t> any(kMin, kMax);
+    std::uniform_int_distribution<int64_t> small(-1000, 1000);
+    for (size_t i = 0; i < 2000; i++) {
+        // both operands near the int64 edges or small, sums and products
+        // of them still fit __int128
+        Wide lhs = i % 3 == 0 ? small(gen) : any(gen);
+        Wide rhs = i % 5 == 0 ? small(gen) : any(gen);
+        Integer x(static_cast<int64_t>(lhs));
+        Integer y(static_cast<int64_t>(rhs));
+
+        ASSERT_EQ(x + y, FromWide(lhs + rhs));
+        ASSERT_EQ(x - y, FromWide(lhs - rhs));
+        ASSERT_EQ(x * y, FromWide(lhs * rhs));
+        ASSERT_EQ(x < y, lhs < rhs);
+        ASSERT_EQ(x >= y, lhs >= rhs);
+        if (rhs != 0) {
+            ASSERT_EQ(x / y, FromWide(lhs / rhs));
+            ASSERT_EQ(x % y, FromWide(lhs % rhs));
+        }
+
+        // products are two limb values, divided back by a large value
+        Integer product = x * y;
+        if (rhs != 0) {
+            Integer quotient = (product + 7) / y;
+            ASSERT_EQ(quotient, FromWide((lhs * rhs + 7) / rhs));
+            ASSERT_EQ((product + 7) % y, FromWide((lhs * rhs + 7) % rhs));
+        }
+    }
+}
+
+TEST(IntegerArithmetics, LongDivision) {
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<int> digit(0, 9);
+    auto random_number = [&](size_t digits) {
+        std::string result(1, '1' + digit(gen) % 9);
+        for (size_t i = 1; i < digits; i++) {
+            result += static_cast<char>('0' + digit(gen));
+        }
+        return Integer(result);
+    };
+
+    for (size_t i = 0; i < 300; i++) {
+        Integer divisor = random_number(10 + i % 40);
+        Integer quotient = random_number(1 + i % 60);
+        Integer remainder = random_number(1 + i % 10) % divisor;
+        if (i % 2 == 1) {
+            // the dividend stays positive, as the remainder
+            divisor = -divisor;
+            quotient = -quotient;
+        }
+        Integer dividend = quotient * divisor + remainder;
+
+        ASSERT_EQ(dividend / divisor, quotient);
+        ASSERT_EQ(dividend % divisor, remainder);
+        ASSERT_EQ(Integer(dividend.ToString()), dividend);
+    }
+
+    // qhat has to be corrected
+    Integer base("4294967296");
+    Integer x = base * base * base - 1;
+    Integer y = base * base - base - 1;
+    ASSERT_EQ(x / y * y + x % y, x);
+    ASSERT_TRUE(x % y < y);
+}
+
+TEST(IntegerArithmetics, Gcd) {
+    ASSERT_EQ(Gcd(Integer(12), Integer(-18)), Integer(6));
+    ASSERT_EQ(Gcd(Integer(0), Integer(-5)), Integer(5));
+    ASSERT_EQ(Gcd(Integer(0), Integer(0)), Integer(0));
+    ASSERT_EQ(Gcd(Integer(kMin), Integer(kMin)), Integer("9223372036854775808"));
+
+    Integer a("123456789123456789123456789");
+    Integer b("987654321987654321");
+    Integer common("1000000007");
+    ASSERT_EQ(Gcd(a * common, b * common), Gcd(a, b) * common);
+    ASSERT_EQ(Gcd(a, b), Integer(9));
+}
+}  // namespace Groebner::Test
@@ -0,0 +1,109 @@
+#include "GroebnerAlgorithm.h"
+#include "Inversion.h"
+#include "gtest/gtest.h"
+
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace Groebner::Test {
+namespace {
+    template <IsSupportedField Field>
+    void CheckInvertBatch(std::mt19937_64& gen, int64_t max_value,
+                          size_t size) {
+        std::uniform_int_distribution<int64_t> value(1, max_value);
+        std::vector<Field> values;
+        for (size_t i = 0; i < size; i++) {
+            Field x = value(gen);
+            values.push_back(x.IsZero() ? Field(1) : x);
+        }
+        std::vector<Field> inverses = values;
+        Details::InvertBatch(std::span(inverses));
+        for (size_t i = 0; i < size; i++) {
+            ASSERT_EQ(values[i] * inverses[i], Field(1));
+        }
+    }
+}  // namespace
+
+TEST(Inversion, FindGcdExtended) {
+    std::mt19937_64 gen(46);
+    std::uniform_int_distribution<int64_t> value(0, 1'000'000'000'000);
+    for (size_t i = 0; i < 1000; i++) {
+        int64_t x = value(gen);
+        int64_t y = value(gen);
+        int64_t coef_x, coef_y;
+        int64_t gcd = Details::FindGcdExtended(x, y, &coef_x, &coef_y);
+        ASSERT_EQ(gcd, std::gcd(x, y));
+        ASSERT_EQ(static_cast<__int128>(coef_x) * x +
+                      static_cast<__int128>(coef_y) * y,
+                  gcd);
+    }
+
+    int64_t coef_x, coef_y;
+    ASSERT_EQ(Details::FindGcdExtended(0, 7, &coef_x, &coef_y), 7);
+    ASSERT_EQ(coef_y, 1);
+    ASSERT_EQ(Details::FindGcdExtended(7, 0, &coef_x, &coef_y), 7);
+    ASSERT_EQ(coef_x, 1);
+}
+
+TEST(Inversion, InverseTable) {
+    constexpr int64_t kPrime = 65521;
+    auto table = Details::BuildInverseTable(kPrime, kPrime);
+    ASSERT_EQ(table.size(), kPrime);
+    for (int64_t i = 1; i < kPrime; i++) {
+        ASSERT_EQ(i * table[i] % kPrime, 1);
+    }
+
+    // the table covers every element of Modulo<65521>
+    for (int64_t i = 1; i < kPrime; i += 97) {
+        Modulo<kPrime> x(i);
+        ASSERT_EQ(x / x, Modulo<kPrime>(1));
+        ASSERT_EQ((Modulo<kPrime>(1) / x).GetValue(), table[i]);
+    }
+}
+
+TEST(Inversion, InvertBatch) {
+    std::mt19937_64 gen(47);
+    CheckInvertBatch<Rational>(gen, 1000, 50);
+    CheckInvertBatch<BigRational>(gen, 1'000'000'000'000, 50);
+    CheckInvertBatch<Modulo<13>>(gen, 12, 100);
+    CheckInvertBatch<Modulo<1000000007>>(gen, 1'000'000'006, 1000);
+    CheckInvertBatch<Modulo<9223372036854775783>>(gen, 9223372036854775782,
+                                                  1000);
+    {
+        RuntimeModulo::Scope scope(998244353);
+        CheckInvertBatch<RuntimeModulo>(gen, 998244352, 1000);
+    }
+
+    std::vector<Modulo<7>> single = {3};
+    Details::InvertBatch(std::span(single));
+    ASSERT_EQ(single[0], Modulo<7>(5));
+    std::vector<Modulo<7>> empty;
+    Details::InvertBatch(std::span(empty));
+}
+
+TEST(Inversion, LeaderNormalization) {
+    using Field = Modulo<1000000007>;
+    Polynomial<Field, LexOrder> x{{3, {2, 0}}, {5, {0, 1}}, {7, {}}};
+    Polynomial<Field, LexOrder> expected{
+        {1, {2, 0}}, {Field(5) / 3, {0, 1}}, {Field(7) / 3, {}}};
+    x.ReduceByLeaderCoef();
+    ASSERT_EQ(x, expected);
+
+    // quotient terms use the leader inverses of the system
+    Polynomial<Field, LexOrder> y1{{3, {1, 0}}, {1, {}}};
+    Polynomial<Field, LexOrder> y2{{5, {0, 1}}};
+    Polynomial<Field, LexOrder> z{{2, {2, 0}}, {4, {0, 1}}};
+    auto rem = GroebnerAlgorithm::ReducePolynomial(
+        z, PolySystem<Field, LexOrder>({y1, y2}));
+    // 2 x^2 -> -2/3 x -> 2/9
+    Polynomial<Field, LexOrder> expected_rem{{Field(2) / 9, {}}};
+    ASSERT_EQ(rem, expected_rem);
+
+    auto basis = GroebnerAlgorithm::BuildGB(
+        PolySystem<Field, LexOrder>({y1, y2}), AutoReduction::Enabled);
+    for (size_t i = 0; i < basis.GetSize(); i++) {
+        ASSERT_EQ(basis[i].GetLeaderCoef(), Field(1));
+    }
+}
+}  // namespace Groebner::Test
@@ -1,7 +1,65 @@
 #include "Modulo.h"
 #include "gtest/gtest.h"
 
+#include <limits>
+#include <random>
+
 namespace Groebner::Test {
+namespace {
+    template <int64_t N>
+    void CheckAgainstWide(std::mt19937_64& gen) {
+        using Wide = __int128;
+        std::uniform_int_distribution<int64_t> any(
+            std::numeric_limits<int64_t>::min(),
+            std::numeric_limits<int64_t>::max());
+        auto reduce = [](Wide value) {
+            Wide result = value % N;
+            return static_cast<int64_t>(result < 0 ? result + N : result);
+        };
+
+        std::vector<int64_t> values = {0, 1, -1, N - 1, N, -N, N + 1,
+                                       std::numeric_limits<int64_t>::min(),
+                                       std::numeric_limits<int64_t>::max()};
+        for (size_t i = 0; i < 200; i++) {
+            values.push_back(any(gen));
+        }
+        for (int64_t lhs : values) {
+            Modulo<N> x(lhs);
+            ASSERT_EQ(x.GetValue(), reduce(lhs));
+            ASSERT_EQ((-x).GetValue(), reduce(-Wide(lhs)));
+            for (size_t j = 0; j < 10; j++) {
+                int64_t rhs = values[gen() % values.size()];
+                Modulo<N> y(rhs);
+                ASSERT_EQ((x + y).GetValue(), reduce(Wide(lhs) + rhs));
+                ASSERT_EQ((x - y).GetValue(), reduce(Wide(lhs) - rhs));
+                ASSERT_EQ((x * y).GetValue(),
+                          reduce(Wide(reduce(lhs)) * reduce(rhs)));
+                if (!y.IsZero()) {
+                    ASSERT_EQ(x / y * y, x);
+                }
+            }
+        }
+    }
+
+    template <int64_t N>
+    void CheckFromUnreduced(std::mt19937_64& gen) {
+        using Wide = unsigned __int128;
+        for (size_t i = 0; i < 1000; i++) {
+            Wide value = (Wide(gen()) << 64) | gen();
+            if (i % 2 == 0) {
+                value >>= 64;
+            }
+            ASSERT_EQ(Modulo<N>::FromUnreduced(value).GetValue(),
+                      static_cast<int64_t>(value % N));
+            uint64_t low = static_cast<uint64_t>(value);
+            ASSERT_EQ(Modulo<N>::FromUnreduced(low).GetValue(),
+                      static_cast<int64_t>(low % N));
+        }
+        ASSERT_EQ(Modulo<N>::FromUnreduced(~Wide(0)).GetValue(),
+                  static_cast<int64_t>(~Wide(0) % N));
+    }
+}  // namespace
+
 TEST(ModuloBasic, Construction) {
     ASSERT_NO_THROW(Modulo<2>(0));
     ASSERT_NO_THROW(Modulo<2>());
@@ -161,4 +219,71 @@ TEST(ModuloArithmetics, UnaryMinus) {
         ASSERT_EQ(-(-x), Modulo<7>(3));
     }
 }
+
+TEST(ModuloArithmetics, Reduction) {
+    std::mt19937_64 gen(42);
+    CheckAgainstWide<2>(gen);
+    CheckAgainstWide<13>(gen);
+    // largest prime below 2^16
+    CheckAgainstWide<65521>(gen);
+    CheckAgainstWide<65537>(gen);
+    CheckAgainstWide<998244353>(gen);
+    CheckAgainstWide<2147483647>(gen);
+    // largest prime below 2^32
+    CheckAgainstWide<4294967291>(gen);
+    // products past 64 bits
+    CheckAgainstWide<4294967311>(gen);
+    CheckAgainstWide<1000000000000000003>(gen);
+    CheckAgainstWide<2305843009213693951>(gen);
+    // largest prime below 2^63
+    CheckAgainstWide<9223372036854775783>(gen);
+}
+
+TEST(ModuloArithmetics, FromUnreduced) {
+    std::mt19937_64 gen(45);
+    CheckFromUnreduced<2>(gen);
+    CheckFromUnreduced<65521>(gen);
+    CheckFromUnreduced<4294967291>(gen);
+    CheckFromUnreduced<4294967311>(gen);
+    CheckFromUnreduced<9223372036854775783>(gen);
+}
+
+TEST(ModuloBasic, Storage) {
+    static_assert(sizeof(Modulo<2>) == 2);
+    static_assert(sizeof(Modulo<65521>) == 2);
+    static_assert(sizeof(Modulo<65537>) == 4);
+    static_assert(sizeof(Modulo<2147483647>) == 4);
+    static_assert(sizeof(Modulo<4294967291>) == 4);
+    static_assert(sizeof(Modulo<4294967311>) == 8);
+
+    // the inverse table of the 16-bit field is complete
+    for (int64_t i = 1; i < 65521; i++) {
+        Modulo<65521> x(i);
+        ASSERT_EQ(x / x, Modulo<65521>(1));
+    }
+}
+
+TEST(ModuloBasic, IsPrime) {
+    static_assert(!IsPrime<1>);
+    static_assert(IsPrime<2>);
+    static_assert(IsPrime<37>);
+    static_assert(!IsPrime<561>);
+    static_assert(IsPrime<998244353>);
+    static_assert(IsPrime<9223372036854775783>);
+    // strong pseudoprimes to the smaller base sets
+    static_assert(!IsPrime<3215031751>);
+    static_assert(!IsPrime<3825123056546413051>);
+    static_assert(!IsPrime<9223372036854775807>);
+
+    size_t count = 0;
+    for (int64_t n = 0; n < 10000; n++) {
+        bool is_prime = n > 1;
+        for (int64_t d = 2; d * d <= n && is_prime; d++) {
+            is_prime = n % d != 0;
+        }
+        ASSERT_EQ(Details::IsPrime(n), is_prime);
+        count += is_prime;
+    }
+    ASSERT_EQ(count, 1229);
+}
 }  // namespace Groebner::Test
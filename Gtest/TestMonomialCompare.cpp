@@ -39,6 +39,40 @@ TEST(Compare, Equal) {
     ASSERT_FALSE(GrevlexOrder::IsEqual(z, x));
 }
 
+TEST(Compare, ThreeWay) {
+    {
+        Monomial x({1, 2, 3, 4, 5, 6, 7, 8, 9});
+        Monomial y({1, 2, 3, 4, 5, 6, 7, 9, 8});
+        Monomial z({1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 0});
+
+        ASSERT_EQ(LexOrder::Compare(x, y), std::strong_ordering::less);
+        ASSERT_EQ(LexOrder::Compare(y, x), std::strong_ordering::greater);
+        ASSERT_EQ(LexOrder::Compare(x, z), std::strong_ordering::equal);
+        ASSERT_EQ(ReverseLexOrder::Compare(x, y),
+                  std::strong_ordering::less);
+        ASSERT_EQ(ReverseLexOrder::Compare(z, x),
+                  std::strong_ordering::equal);
+        ASSERT_EQ(GrlexOrder::Compare(x, y), std::strong_ordering::less);
+        ASSERT_EQ(GrevlexOrder::Compare(x, y), std::strong_ordering::less);
+        ASSERT_EQ(GrevlexOrder::Compare(x, z), std::strong_ordering::equal);
+    }
+
+    {
+        Monomial x({0, 1, 0, 0, 0, 0});
+        Monomial y({0, 1, 0, 0, 0, 0, 0, 1});
+        Monomial z({1});
+
+        ASSERT_EQ(LexOrder::Compare(x, y), std::strong_ordering::less);
+        ASSERT_EQ(LexOrder::Compare(z, y), std::strong_ordering::greater);
+        ASSERT_EQ(ReverseLexOrder::Compare(x, y),
+                  std::strong_ordering::greater);
+        ASSERT_EQ(ReverseLexOrder::Compare(y, z), std::strong_ordering::less);
+        ASSERT_EQ(GrlexOrder::Compare(z, x), std::strong_ordering::greater);
+        ASSERT_EQ(GrevlexOrder::Compare(y, x), std::strong_ordering::greater);
+        ASSERT_EQ(GrevlexOrder::Compare(z, x), std::strong_ordering::greater);
+    }
+}
+
 TEST(CompareStraightCoordinateOrder, Less) {
     {
         Monomial x({1, 1, 1});
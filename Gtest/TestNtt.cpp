@@ -0,0 +1,58 @@
+#include "Ntt.h"
+#include "gtest/gtest.h"
+
+#include <random>
+
+namespace Groebner::Test {
+namespace {
+    std::vector<Details::NttValueType> Naive(
+        const std::vector<Details::NttValueType>& lhs,
+        const std::vector<Details::NttValueType>& rhs,
+        Details::NttValueType modulus) {
+        std::vector<Details::NttValueType> result(lhs.size() + rhs.size() - 1);
+        for (size_t i = 0; i < lhs.size(); i++) {
+            for (size_t j = 0; j < rhs.size(); j++) {
+                result[i + j] =
+                    (result[i + j] + uint64_t(lhs[i]) * rhs[j]) % modulus;
+            }
+        }
+        return result;
+    }
+
+    std::vector<Details::NttValueType> Random(std::mt19937& gen, size_t size,
+                                              Details::NttValueType modulus) {
+        std::uniform_int_distribution<Details::NttValueType> dist(0,
+                                                                  modulus - 1);
+        std::vector<Details::NttValueType> result(size);
+        for (auto& value : result) {
+            value = dist(gen);
+        }
+        return result;
+    }
+}  // namespace
+
+TEST(Ntt, Convolution) {
+    std::mt19937 gen(3);
+    for (Details::NttValueType modulus :
+         {2u, 7u, 100049u, 998244353u, 1000000007u, 2147483647u}) {
+        for (auto [lhs_size, rhs_size] : {std::pair<size_t, size_t>{1, 1},
+                                          {1, 17},
+                                          {33, 64},
+                                          {300, 257}}) {
+            auto lhs = Random(gen, lhs_size, modulus);
+            auto rhs = Random(gen, rhs_size, modulus);
+            ASSERT_EQ(Details::ConvolveModulo(lhs, rhs, modulus),
+                      Naive(lhs, rhs, modulus));
+        }
+    }
+}
+
+TEST(Ntt, MaximalCoefficients) {
+    // every product is (p - 1)^2, the exact sums need all three primes
+    Details::NttValueType modulus = 2147483647;
+    std::vector<Details::NttValueType> values(4096, modulus - 1);
+    auto result = Details::ConvolveModulo(values, values, modulus);
+    ASSERT_EQ(result, Naive(values, values, modulus));
+    ASSERT_TRUE(Details::ConvolveModulo({}, values, modulus).empty());
+}
+}  // namespace Groebner::Test
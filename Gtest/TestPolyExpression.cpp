@@ -0,0 +1,75 @@
+#include "PolyExpression.h"
+#include "gtest/gtest.h"
+
+#include <random>
+
+namespace Groebner::Test {
+namespace {
+    template <IsSupportedField Field, IsComparator Comparator>
+    Polynomial<Field, Comparator> RandomPoly(std::mt19937& gen, size_t size) {
+        std::uniform_int_distribution<int> coef(-5, 5);
+        std::uniform_int_distribution<Monomial::DegreeType> degree(0, 4);
+        std::vector<Term<Field>> terms;
+        for (size_t i = 0; i < size; i++) {
+            terms.push_back({coef(gen), {degree(gen), degree(gen), degree(gen)}});
+        }
+        return Polynomial<Field, Comparator>(std::move(terms));
+    }
+}  // namespace
+
+TEST(PolyExpression, Basic) {
+    using Poly = Polynomial<Rational>;
+    Poly p = {{1, {2}}, {3, {0, 1}}};
+    Poly q = {{2, {1}}, {-1, {}}};
+    Poly r = {{5, {3}}, {1, {}}};
+    RationalTerm t1 = {2, {0, 1}};
+    RationalTerm t2 = {Rational(1, 2), {2}};
+
+    Poly lazy = Lazy(p) * t1 - Lazy(q) * t2 + Lazy(r);
+    Poly eager = p * t1 - q * t2 + r;
+    ASSERT_EQ(lazy, eager);
+
+    Poly sum = Lazy(p) + q;
+    ASSERT_EQ(sum, p + q);
+    Poly negated = -Lazy(p) - r;
+    ASSERT_EQ(negated, -p - r);
+
+    Poly cancelled = Lazy(p) - Lazy(p);
+    ASSERT_TRUE(cancelled.IsZero());
+    Poly scaled_zero = Lazy(p) * RationalTerm{0, {1}} + q;
+    ASSERT_EQ(scaled_zero, q);
+
+    Poly zero;
+    Poly with_zero = Lazy(zero) * t1 + Lazy(zero);
+    ASSERT_TRUE(with_zero.IsZero());
+}
+
+TEST(PolyExpression, EvaluateInto) {
+    using Poly = Polynomial<Rational, GrevlexOrder>;
+    Poly p = {{1, {2}}, {3, {0, 1}}, {-2, {1, 1}}};
+    Poly q = {{2, {1}}, {-1, {}}};
+    RationalTerm t = {3, {1}};
+
+    Poly expected = p * t - q;
+    (Lazy(p) * t - Lazy(q)).EvaluateInto(p);
+    ASSERT_EQ(p, expected);
+    ASSERT_EQ(p.GetLeaderMask(), expected.GetLeaderMask());
+    ASSERT_EQ(p.GetTotalDegree(), expected.GetTotalDegree());
+}
+
+TEST(PolyExpression, MatchesEager) {
+    std::mt19937 gen(39);
+    using Poly = Polynomial<Modulo<7>, GrlexOrder>;
+    for (size_t iteration = 0; iteration < 50; iteration++) {
+        Poly p = RandomPoly<Modulo<7>, GrlexOrder>(gen, 20);
+        Poly q = RandomPoly<Modulo<7>, GrlexOrder>(gen, 20);
+        Poly r = RandomPoly<Modulo<7>, GrlexOrder>(gen, 5);
+        ModuloTerm<7> t1 = {3, {1, 0, 2}};
+        ModuloTerm<7> t2 = {5, {0, 1}};
+
+        Poly lazy = Lazy(p) * t1 - Lazy(q) * t2 + Lazy(r) * t2 * t1;
+        Poly eager = p * t1 - q * t2 + r * t2 * t1;
+        ASSERT_EQ(lazy, eager);
+    }
+}
+}  // namespace Groebner::Test
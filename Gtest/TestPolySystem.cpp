@@ -25,6 +25,25 @@ TEST(PolySystemBasic, Construction) {
     CheckEqual(system, PolySystem<Rational, LexOrder>(std::move(temp)));
 }
 
+TEST(PolySystemBasic, OrderConversion) {
+    Polynomial<Rational, GrevlexOrder> x = {{3, {2, 0}}, {1, {0, 0, 3}}};
+    Polynomial<Rational, GrevlexOrder> y = {{1, {1, 1}}, {2, {0, 1}}, {1, {}}};
+    PolySystem<Rational, GrevlexOrder> grevlex({x, y});
+
+    PolySystem<Rational, LexOrder> lex(grevlex);
+    ASSERT_EQ(lex.GetSize(), 2);
+    ASSERT_EQ(lex[0], x);
+    ASSERT_EQ(lex[1], y);
+    ASSERT_EQ(lex[0].GetLeaderDegree(), Monomial({2}));
+
+    PolySystem<Rational, GrlexOrder> grlex(std::move(lex));
+    ASSERT_TRUE(lex.IsEmpty());
+    ASSERT_EQ(grlex.GetSize(), 2);
+    ASSERT_EQ(grlex[0], x);
+    ASSERT_EQ(grlex[1], y);
+    ASSERT_EQ(grlex[0].GetLeaderDegree(), Monomial({0, 0, 3}));
+}
+
 TEST(PolySystemBasic, Pop) {
     Polynomial<Rational, LexOrder> x = {{3, {2, 0}}, {1, {1, 1}}, {2, {0, 1}}};
     Polynomial<Rational, LexOrder> y = {{3, {2, 1}}, {1, {1, 1}}, {2, {0, 1}}};
@@ -1,7 +1,12 @@
+#include "CountingResource.h"
 #include "Polynomial.h"
 #include "gtest/gtest.h"
 
+#include <memory_resource>
+#include <random>
+
 namespace Groebner::Test {
+
 template <IsSupportedField Field, IsComparator Comparator>
 void CheckEqual(const Polynomial<Field, Comparator>& poly,
                 const std::vector<Term<Field>>& expected) {
@@ -12,9 +17,12 @@ void CheckEqual(const Polynomial<Field, Comparator>& poly,
 
 template <IsSupportedField Field, IsComparator Comparator>
 void CheckSorted(const Polynomial<Field, Comparator>& poly) {
-    for (size_t i = 0; i + 1 < poly.GetSize(); ++i) {
-        ASSERT_TRUE(Comparator::IsGreater(poly.GetAt(i).degree,
-                                          poly.GetAt(i + 1).degree));
+    const Monomial* prev = nullptr;
+    for (const auto& [degree, coef] : poly) {
+        if (prev) {
+            ASSERT_TRUE(Comparator::IsGreater(*prev, degree));
+        }
+        prev = &degree;
     }
 };
 
@@ -155,6 +163,156 @@ TEST(PolynomialBasic, Leading) {
     }
 }
 
+TEST(PolynomialBasic, Iteration) {
+    std::vector<RationalTerm> x{
+        {3, {0, 0, 1}}, {1, {2, 1}}, {-2, {1, 0, 1}}, {5, {}}};
+    Polynomial<Rational, LexOrder> poly(x.begin(), x.end());
+
+    ASSERT_EQ(poly.GetLeaderDegree(), Monomial({2, 1}));
+    ASSERT_EQ(poly.GetLeaderCoef(), 1);
+
+    std::vector<RationalTerm> expected{x[1], x[2], x[0], x[3]};
+    size_t i = 0;
+    for (const auto& [degree, coef] : poly) {
+        ASSERT_LT(i, expected.size());
+        ASSERT_EQ(degree, expected[i].degree);
+        ASSERT_EQ(coef, expected[i].coef);
+        ASSERT_EQ(poly.GetAt(i), expected[i]);
+        ++i;
+    }
+    ASSERT_EQ(i, poly.GetSize());
+}
+
+TEST(PolynomialBasic, MoveLeaderTo) {
+    Polynomial<Rational, LexOrder> poly = {{1, {2}}, {3, {1}}, {1, {}}};
+    Polynomial<Rational, LexOrder> rem = {{-1, {2}}, {4, {}}};
+
+    poly.MoveLeaderTo(rem);
+    ASSERT_EQ(poly, Polynomial<Rational>({{3, {1}}, {1, {}}}));
+    ASSERT_EQ(rem, Polynomial<Rational>({{4, {}}}));
+
+    poly.MoveLeaderTo(rem);
+    ASSERT_EQ(poly, Polynomial<Rational>({{1, {}}}));
+    ASSERT_EQ(rem, Polynomial<Rational>({{3, {1}}, {4, {}}}));
+
+    std::pmr::monotonic_buffer_resource resource;
+    Polynomial<Rational, LexOrder> other(&resource);
+    poly.MoveLeaderTo(other);
+    ASSERT_TRUE(poly.IsZero());
+    ASSERT_EQ(other, Polynomial<Rational>({{1, {}}}));
+}
+
+TEST(PolynomialBasic, Metadata) {
+    Polynomial<Rational, LexOrder> poly = {{1, {2, 0, 1}}, {3, {0, 4}}};
+    ASSERT_EQ(poly.GetLeaderMask(), 0b101);
+    ASSERT_EQ(poly.GetTotalDegree(), 4);
+
+    poly += RationalTerm{1, {0, 0, 7}};
+    ASSERT_EQ(poly.GetTotalDegree(), 7);
+
+    poly -= RationalTerm{1, {2, 0, 1}};
+    ASSERT_EQ(poly.GetLeaderMask(), 0b10);
+    ASSERT_EQ(poly.GetTotalDegree(), 7);
+
+    poly *= RationalTerm{2, {1}};
+    ASSERT_EQ(poly.GetLeaderMask(), 0b11);
+    ASSERT_EQ(poly.GetTotalDegree(), 8);
+
+    Polynomial<Rational, LexOrder> moved(std::move(poly));
+    ASSERT_EQ(moved.GetLeaderMask(), 0b11);
+    poly = Polynomial<Rational, LexOrder>({{1, {}}});
+    ASSERT_EQ(poly.GetLeaderMask(), 0);
+    ASSERT_EQ(poly.GetTotalDegree(), 0);
+
+    Polynomial<Rational, LexOrder> rem;
+    moved.MoveLeaderTo(rem);
+    ASSERT_EQ(rem.GetLeaderMask(), 0b11);
+    ASSERT_EQ(moved.GetLeaderMask(), 0b101);
+    ASSERT_EQ(moved.GetTotalDegree(), 8);
+
+    // the leader mask and the total degree are filled independently
+    moved.SubMulTerm(Polynomial<Rational, LexOrder>({{1, {1, 0, 1}}}),
+                     RationalTerm{1, {0, 0, 0, 9}});
+    ASSERT_EQ(moved.GetLeaderMask(), 0b101);
+    ASSERT_EQ(moved.GetTotalDegree(), 11);
+
+    ASSERT_TRUE(Polynomial<Rational>().GetTotalDegree() == 0);
+}
+
+TEST(PolynomialBasic, IsLeaderDivisibleBy) {
+    Polynomial<Rational, LexOrder> poly = {{1, {2, 1, 1}}, {1, {}}};
+    ASSERT_TRUE(poly.IsLeaderDivisibleBy(
+        Polynomial<Rational, LexOrder>({{2, {1, 1}}, {1, {0, 5}}})));
+    ASSERT_TRUE(poly.IsLeaderDivisibleBy(poly));
+    ASSERT_FALSE(poly.IsLeaderDivisibleBy(
+        Polynomial<Rational, LexOrder>({{1, {3}}})));
+    ASSERT_FALSE(poly.IsLeaderDivisibleBy(
+        Polynomial<Rational, LexOrder>({{1, {0, 0, 0, 1}}})));
+    ASSERT_FALSE(poly.IsLeaderDivisibleBy(
+        Polynomial<Rational, LexOrder>({{1, {0, 2}}})));
+}
+
+TEST(PolynomialBasic, BulkConstruction) {
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<Monomial::DegreeType> degree_dist(0, 3);
+    std::uniform_int_distribution<int64_t> coef_dist(-2, 2);
+
+    std::vector<RationalTerm> terms;
+    for (size_t i = 0; i < 2000; i++) {
+        terms.push_back({coef_dist(gen),
+                         {degree_dist(gen), degree_dist(gen), degree_dist(gen)}});
+    }
+
+    Polynomial<Rational, GrevlexOrder> expected;
+    for (const auto& term : terms) {
+        expected += term;
+    }
+    CheckSorted(expected);
+
+    Polynomial<Rational, GrevlexOrder> from_range(terms.begin(), terms.end());
+    ASSERT_EQ(from_range, expected);
+
+    auto copy = terms;
+    Polynomial<Rational, GrevlexOrder> from_vector(std::move(copy));
+    ASSERT_EQ(from_vector, expected);
+
+    Polynomial<Rational> cancelled = {{1, {1}}, {2, {}}, {-1, {1, 0}}};
+    ASSERT_EQ(cancelled, Polynomial<Rational>({{2, {}}}));
+}
+
+TEST(PolynomialBasic, OrderConversion) {
+    std::vector<RationalTerm> x{{1, {1, 0, 3}},
+                                {2, {2, 1}},
+                                {-3, {0, 0, 4}},
+                                {4, {3}},
+                                {5, {}}};
+    Polynomial<Rational, GrevlexOrder> grevlex(x.begin(), x.end());
+    Polynomial<Rational, LexOrder> lex(x.begin(), x.end());
+
+    Polynomial<Rational, LexOrder> converted(grevlex);
+    CheckSorted(converted);
+    ASSERT_EQ(converted, lex);
+    ASSERT_EQ(converted, grevlex);
+    ASSERT_EQ(grevlex, converted);
+    ASSERT_EQ(converted.GetLeaderDegree(), Monomial({3}));
+
+    lex += RationalTerm{1, {}};
+    ASSERT_NE(lex, grevlex);
+
+    CountingResource resource;
+    Polynomial<Rational, GrevlexOrder> source(grevlex, &resource);
+    size_t allocated = resource.allocated;
+    Polynomial<Rational, LexOrder> moved(std::move(source), &resource);
+    ASSERT_EQ(resource.allocated, allocated);
+    ASSERT_TRUE(source.IsZero());
+    CheckSorted(moved);
+    ASSERT_EQ(moved, converted);
+
+    Polynomial<Rational, GrevlexOrder> other_resource(std::move(moved));
+    CheckSorted(other_resource);
+    ASSERT_EQ(other_resource, grevlex);
+}
+
 TEST(PolynomialBasic, IsZero) {
     {
         std::vector<RationalTerm> x{
@@ -690,6 +848,211 @@ TEST(PolynomialArithmetics, Multiplication) {
     }
 }
 
+template <IsComparator Comparator>
+void CheckMultiplication(const std::vector<RationalTerm>& x,
+                         const std::vector<RationalTerm>& y) {
+    Polynomial<Rational, Comparator> lhs(x.begin(), x.end());
+    Polynomial<Rational, Comparator> rhs(y.begin(), y.end());
+
+    Polynomial<Rational, Comparator> expected;
+    for (const auto& lhs_term : x) {
+        for (const auto& rhs_term : y) {
+            expected += RationalTerm{lhs_term.coef * rhs_term.coef,
+                                     lhs_term.degree + rhs_term.degree};
+        }
+    }
+
+    auto product = lhs * rhs;
+    CheckSorted(product);
+    ASSERT_EQ(product, expected);
+    ASSERT_EQ(rhs * lhs, expected);
+
+    auto square = lhs * lhs;
+    lhs *= lhs;
+    CheckSorted(lhs);
+    ASSERT_EQ(lhs, square);
+}
+
+std::vector<RationalTerm> RandomTerms(std::mt19937& gen, size_t count,
+                                      size_t vars,
+                                      Monomial::DegreeType max_degree) {
+    std::uniform_int_distribution<Monomial::DegreeType> degree_dist(
+        0, max_degree);
+    std::uniform_int_distribution<int64_t> coef_dist(-3, 3);
+    std::vector<RationalTerm> result;
+    for (size_t i = 0; i < count; i++) {
+        Monomial degree(vars);
+        for (size_t j = 0; j < vars; j++) {
+            degree.SetDegree(j, degree_dist(gen));
+        }
+        result.push_back({coef_dist(gen), std::move(degree)});
+    }
+    return result;
+}
+
+TEST(PolynomialArithmetics, MultiplicationPaths) {
+    using WeightedMatrix = MatrixOrder<Weights<1, 2>>;
+    std::mt19937 gen(11);
+    for (size_t iter = 0; iter < 10; iter++) {
+        // small box, dense accumulation
+        auto dense_x = RandomTerms(gen, 12, 2, 3);
+        auto dense_y = RandomTerms(gen, 9, 2, 2);
+        CheckMultiplication<LexOrder>(dense_x, dense_y);
+        CheckMultiplication<GrevlexOrder>(dense_x, dense_y);
+        CheckMultiplication<WeightedMatrix>(dense_x, dense_y);
+
+        // wide sparse supports, heap merge
+        auto sparse_x = RandomTerms(gen, 15, 5, 20);
+        auto sparse_y = RandomTerms(gen, 7, 6, 20);
+        CheckMultiplication<LexOrder>(sparse_x, sparse_y);
+        CheckMultiplication<GrlexOrder>(sparse_x, sparse_y);
+        CheckMultiplication<GrevlexOrder>(sparse_x, sparse_y);
+    }
+
+    // large dense products over a prime field go through NTT
+    {
+        using Field = Modulo<1000003>;
+        std::vector<ModuloTerm<1000003>> x, y;
+        std::uniform_int_distribution<int64_t> coef_dist(0, 1000002);
+        for (Monomial::DegreeType i = 0; i <= 20; i++) {
+            for (Monomial::DegreeType j = 0; j <= 20; j++) {
+                x.push_back({coef_dist(gen), {i, j}});
+                y.push_back({coef_dist(gen), {j, i}});
+            }
+        }
+        Polynomial<Field, GrevlexOrder> lhs(x.begin(), x.end());
+        Polynomial<Field, GrevlexOrder> rhs(y.begin(), y.end());
+
+        Polynomial<Field, GrevlexOrder> expected;
+        for (const auto& lhs_term : x) {
+            expected.SubMulTerm(rhs, {-lhs_term.coef, lhs_term.degree});
+        }
+
+        auto product = lhs * rhs;
+        CheckSorted(product);
+        ASSERT_EQ(product, expected);
+    }
+
+    // everything cancels
+    Polynomial<Rational> x_plus_y = {{1, {1}}, {1, {0, 1}}};
+    Polynomial<Rational> x_minus_y = {{1, {1}}, {-1, {0, 1}}};
+    Polynomial<Rational> expected = {{1, {2}}, {-1, {0, 2}}};
+    ASSERT_EQ(x_plus_y * x_minus_y, expected);
+    ASSERT_TRUE((x_plus_y * Polynomial<Rational>()).IsZero());
+    ASSERT_TRUE((x_plus_y * RationalTerm{0, {1}}).IsZero());
+}
+
+TEST(PolynomialArithmetics, MultiplyParallel) {
+    std::mt19937 gen(13);
+    auto x = RandomTerms(gen, 300, 4, 10);
+    auto y = RandomTerms(gen, 250, 5, 10);
+
+    Polynomial<Rational, GrevlexOrder> lhs(x.begin(), x.end());
+    Polynomial<Rational, GrevlexOrder> rhs(y.begin(), y.end());
+    auto expected = lhs * rhs;
+
+    for (size_t threads : {1, 3, 4}) {
+        auto product = lhs.MultiplyParallel(rhs, threads);
+        CheckSorted(product);
+        ASSERT_EQ(product, expected);
+    }
+    ASSERT_EQ(rhs.MultiplyParallel(lhs), expected);
+
+    // cancellation across chunks
+    auto negated = lhs * RationalTerm{-1, {}};
+    ASSERT_TRUE((lhs + negated).MultiplyParallel(rhs, 4).IsZero());
+}
+
+TEST(PolynomialArithmetics, RvalueOperators) {
+    Polynomial<Rational> x = {{1, {2}}, {2, {1, 1}}, {3, {}}};
+    Polynomial<Rational> y = {{-1, {2}}, {1, {0, 2}}, {1, {}}};
+    Polynomial<Rational> sum = {{2, {1, 1}}, {1, {0, 2}}, {4, {}}};
+    Polynomial<Rational> difference = {
+        {2, {2}}, {2, {1, 1}}, {-1, {0, 2}}, {2, {}}};
+
+    ASSERT_EQ(Polynomial<Rational>(x) + y, sum);
+    ASSERT_EQ(x + Polynomial<Rational>(y), sum);
+    ASSERT_EQ(Polynomial<Rational>(x) + Polynomial<Rational>(y), sum);
+    ASSERT_EQ(Polynomial<Rational>(x) - y, difference);
+    ASSERT_EQ(x - Polynomial<Rational>(y), difference);
+    ASSERT_EQ(Polynomial<Rational>(x) - Polynomial<Rational>(y), difference);
+    ASSERT_EQ(-Polynomial<Rational>(y) + x, difference);
+    ASSERT_EQ(-(y - x), difference);
+
+    RationalTerm term{2, {1}};
+    ASSERT_EQ(Polynomial<Rational>(x) * term, x * term);
+    ASSERT_EQ(Polynomial<Rational>(x) + term, x + term);
+    ASSERT_EQ(Polynomial<Rational>(x) - term, x - term);
+
+    RationalTerm two{2, {}};
+    auto twice = x;
+    twice += twice;
+    ASSERT_EQ(twice, x * two);
+    twice -= twice;
+    ASSERT_TRUE(twice.IsZero());
+
+    // rvalue operands give their nodes away
+    CountingResource resource;
+    Polynomial<Rational> lhs(x, &resource);
+    Polynomial<Rational> rhs(y, &resource);
+    size_t allocated = resource.allocated;
+    RationalTerm three{3, {}};
+    auto result = std::move(lhs) + std::move(rhs);
+    result = std::move(result) * three;
+    ASSERT_EQ(resource.allocated, allocated);
+    ASSERT_EQ(result, sum * three);
+
+    Polynomial<Rational> degree_term(&resource);
+    degree_term += RationalTerm{1, {5}};
+    ASSERT_EQ(degree_term.GetLeaderDegree(), Monomial({5}));
+    RationalTerm quotient = RationalTerm{4, {3}} / RationalTerm{2, {1}};
+    ASSERT_EQ(quotient.coef, 2);
+    ASSERT_EQ(quotient.degree, Monomial({2}));
+}
+
+TEST(PolynomialArithmetics, SubMulTerm) {
+    {
+        Polynomial<Rational, LexOrder> x{{1, {3, 0}}, {2, {1, 1}}, {1, {0}}};
+        Polynomial<Rational, LexOrder> y{{1, {2, 0}}, {-1, {0, 1}}};
+        RationalTerm t{3, {1, 0}};
+
+        auto expected = x - y * t;
+        x.SubMulTerm(y, t);
+        CheckSorted(x);
+        ASSERT_EQ(x, expected);
+    }
+
+    {
+        // leader cancels, the rest merges in between existing terms
+        Polynomial<Modulo<5>, GrevlexOrder> x{
+            {2, {2, 2}}, {1, {1, 1}}, {4, {0, 1}}};
+        Polynomial<Modulo<5>, GrevlexOrder> y{{1, {1, 1}}, {3, {1, 0}}};
+        ModuloTerm<5> t{2, {1, 1}};
+
+        auto expected = x - y * t;
+        x.SubMulTerm(y, t);
+        CheckSorted(x);
+        ASSERT_EQ(x, expected);
+        ASSERT_EQ(x.GetLeader(), ModuloTerm<5>(4, {2, 1}));
+    }
+
+    {
+        Polynomial<Rational, GrlexOrder> x{{1, {1, 2}}, {-2, {1}}};
+        auto expected = x - x * RationalTerm{1, {}};
+        x.SubMulTerm(x, {1, {}});
+        ASSERT_TRUE(x.IsZero());
+        ASSERT_EQ(x, expected);
+
+        Polynomial<Rational, GrlexOrder> y{{1, {1, 2}}, {-2, {1}}};
+        Polynomial<Rational, GrlexOrder> copy(y);
+        Polynomial<Rational, GrlexOrder> zero;
+        y.SubMulTerm(zero, {5, {1}});
+        ASSERT_EQ(y, copy);
+        zero.SubMulTerm(y, {-1, {}});
+        ASSERT_EQ(zero, y);
+    }
+}
+
 TEST(TermArithmetics, Division) {
     {
         RationalTerm x{1, {2, 3}};
@@ -725,4 +1088,33 @@ TEST(TermArithmetics, Division) {
         ASSERT_DEATH(x / y, "Can't divide by zero");
     }
 }
+
+TEST(PolynomialBasic, MemoryResource) {
+    CountingResource resource;
+    {
+        Polynomial<Rational, LexOrder> x({{1, {2, 0}}, {3, {1, 1}}},
+                                         &resource);
+        ASSERT_EQ(x.GetResource(), &resource);
+        ASSERT_GT(resource.allocated, 0);
+
+        Polynomial<Rational, LexOrder> y{{1, {1}}, {-1, {0, 1}}};
+        ASSERT_EQ(y.GetResource(), std::pmr::get_default_resource());
+
+        size_t before = resource.allocated;
+        auto z = x * y - x;
+        ASSERT_EQ(z.GetResource(), &resource);
+        ASSERT_GT(resource.allocated, before);
+
+        Polynomial<Rational, LexOrder> expected{
+            {1, {3, 0}}, {2, {2, 1}}, {-3, {1, 2}}, {-1, {2, 0}}, {-3, {1, 1}}};
+        ASSERT_EQ(z, expected);
+
+        Polynomial<Rational, LexOrder> copy(z);
+        ASSERT_EQ(copy.GetResource(), std::pmr::get_default_resource());
+        Polynomial<Rational, LexOrder> moved(std::move(copy), &resource);
+        ASSERT_EQ(moved.GetResource(), &resource);
+        ASSERT_EQ(moved, expected);
+    }
+    ASSERT_EQ(resource.outstanding, 0);
+}
 }  // namespace Groebner::Test
@@ -0,0 +1,137 @@
+#include "GroebnerAlgorithm.h"
+#include "RuntimeModulo.h"
+#include "gtest/gtest.h"
+
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace Groebner::Test {
+namespace {
+    template <int64_t N>
+    void CheckSameAsModulo(std::mt19937_64& gen) {
+        RuntimeModulo::Scope scope(N);
+        ASSERT_EQ(RuntimeModulo::GetModulus(), N);
+
+        std::uniform_int_distribution<int64_t> any(
+            std::numeric_limits<int64_t>::min(),
+            std::numeric_limits<int64_t>::max());
+        std::uniform_int_distribution<int64_t> small(-1000, 1000);
+        for (size_t i = 0; i < 500; i++) {
+            int64_t lhs = i % 2 ? any(gen) : small(gen);
+            int64_t rhs = i % 3 ? any(gen) : small(gen);
+            RuntimeModulo x(lhs);
+            RuntimeModulo y(rhs);
+            Modulo<N> expected_x(lhs);
+            Modulo<N> expected_y(rhs);
+
+            ASSERT_EQ(x.GetValue(), expected_x.GetValue());
+            ASSERT_EQ((-x).GetValue(), (-expected_x).GetValue());
+            ASSERT_EQ((x + y).GetValue(), (expected_x + expected_y).GetValue());
+            ASSERT_EQ((x - y).GetValue(), (expected_x - expected_y).GetValue());
+            ASSERT_EQ((x * y).GetValue(), (expected_x * expected_y).GetValue());
+            if (!y.IsZero()) {
+                ASSERT_EQ((x / y).GetValue(),
+                          (expected_x / expected_y).GetValue());
+            }
+        }
+    }
+
+    template <IsSupportedField Field>
+    PolySystem<Field, GrlexOrder> MakeSystem() {
+        Polynomial<Field, GrlexOrder> x = {{1, {2, 0}}, {1, {1, 1}}, {1, {}}};
+        Polynomial<Field, GrlexOrder> y = {{1, {1, 1}}, {-1, {0, 2}}};
+        Polynomial<Field, GrlexOrder> z = {{3, {0, 1, 1}}, {-2, {1}}};
+        return PolySystem<Field, GrlexOrder>({x, y, z});
+    }
+
+    template <int64_t N>
+    void CheckSameBasis() {
+        auto expected = GroebnerAlgorithm::BuildGB(MakeSystem<Modulo<N>>(),
+                                                   AutoReduction::Enabled);
+        RuntimeModulo::Scope scope(N);
+        auto basis = GroebnerAlgorithm::BuildGB(MakeSystem<RuntimeModulo>(),
+                                                AutoReduction::Enabled);
+
+        ASSERT_EQ(basis.GetSize(), expected.GetSize());
+        for (size_t i = 0; i < basis.GetSize(); i++) {
+            ASSERT_EQ(basis[i].GetSize(), expected[i].GetSize());
+            auto it = expected[i].begin();
+            for (const auto& [degree, coef] : basis[i]) {
+                ASSERT_EQ(degree, it->first);
+                ASSERT_EQ(coef.GetValue(), it->second.GetValue());
+                ++it;
+            }
+        }
+    }
+
+    std::vector<Term<RuntimeModulo>> RandomTerms(std::mt19937_64& gen,
+                                                 size_t count) {
+        std::uniform_int_distribution<int64_t> coef(1, 1000);
+        std::uniform_int_distribution<Monomial::DegreeType> degree(0, 9);
+        std::vector<Term<RuntimeModulo>> terms;
+        for (size_t i = 0; i < count; i++) {
+            terms.push_back({RuntimeModulo(coef(gen)),
+                             Monomial({degree(gen), degree(gen), degree(gen)})});
+        }
+        return terms;
+    }
+}  // namespace
+
+TEST(RuntimeModuloBasic, Scope) {
+    static_assert(IsSupportedField<RuntimeModulo>);
+    // zero is fine without a scope
+    ASSERT_TRUE(RuntimeModulo().IsZero());
+
+    RuntimeModulo::Scope outer(7);
+    ASSERT_EQ(RuntimeModulo(-1).GetValue(), 6);
+    {
+        RuntimeModulo::Scope inner(11);
+        ASSERT_EQ(RuntimeModulo::GetModulus(), 11);
+        ASSERT_EQ(RuntimeModulo(-1).GetValue(), 10);
+        ASSERT_EQ(RuntimeModulo(1) / RuntimeModulo(2), RuntimeModulo(6));
+    }
+    ASSERT_EQ(RuntimeModulo::GetModulus(), 7);
+    ASSERT_EQ(RuntimeModulo(1) / RuntimeModulo(2), RuntimeModulo(4));
+    ASSERT_DEATH(RuntimeModulo::Scope(8), "Modulus must be prime");
+}
+
+TEST(RuntimeModuloArithmetics, SameAsModulo) {
+    std::mt19937_64 gen(44);
+    CheckSameAsModulo<2>(gen);
+    CheckSameAsModulo<13>(gen);
+    CheckSameAsModulo<65537>(gen);
+    CheckSameAsModulo<998244353>(gen);
+    CheckSameAsModulo<4294967311>(gen);
+    CheckSameAsModulo<9223372036854775783>(gen);
+}
+
+TEST(RuntimeModuloArithmetics, Inverses) {
+    // past the inverse table too
+    RuntimeModulo::Scope scope(1000003);
+    for (int64_t value = 1; value < 200000; value += 7) {
+        RuntimeModulo x(value);
+        ASSERT_EQ(x * (RuntimeModulo(1) / x), RuntimeModulo(1));
+    }
+}
+
+TEST(RuntimeModuloArithmetics, MultiplyParallel) {
+    // workers have no scope of their own, they share the caller's
+    RuntimeModulo::Scope scope(1000003);
+    std::mt19937_64 gen(37);
+    auto x_terms = RandomTerms(gen, 300);
+    auto y_terms = RandomTerms(gen, 300);
+    Polynomial<RuntimeModulo, GrevlexOrder> x(x_terms.begin(), x_terms.end());
+    Polynomial<RuntimeModulo, GrevlexOrder> y(y_terms.begin(), y_terms.end());
+
+    auto expected = x * y;
+    ASSERT_EQ(x.MultiplyParallel(y, 4), expected);
+    ASSERT_EQ(RuntimeModulo::GetModulus(), 1000003);
+}
+
+TEST(RuntimeModuloGroebner, SameAsModulo) {
+    CheckSameBasis<5>();
+    CheckSameBasis<7>();
+    CheckSameBasis<1000003>();
+}
+}  // namespace Groebner::Test
@@ -0,0 +1,128 @@
+#include "GroebnerAlgorithm.h"
+#include "gtest/gtest.h"
+
+namespace Groebner::Test {
+namespace {
+    std::vector<Monomial> AllMonomials(size_t vars, size_t max_degree) {
+        std::vector<Monomial> result = {Monomial(vars)};
+        for (size_t i = 0; i < vars; i++) {
+            std::vector<Monomial> next;
+            for (const auto& monomial : result) {
+                for (size_t degree = 0; degree <= max_degree; degree++) {
+                    Monomial temp(monomial);
+                    temp.SetDegree(i, degree);
+                    next.push_back(std::move(temp));
+                }
+            }
+            result = std::move(next);
+        }
+        return result;
+    }
+
+    template <IsComparator Lhs, IsComparator Rhs>
+    void CheckSameOrder(const std::vector<Monomial>& monomials) {
+        for (const auto& x : monomials) {
+            for (const auto& y : monomials) {
+                ASSERT_EQ(Lhs::Compare(x, y), Rhs::Compare(x, y));
+            }
+        }
+    }
+}  // namespace
+
+TEST(CompareWeightedOrder, Basic) {
+    using Order = WeightedOrder<Weights<1, 2>>;
+    static_assert(IsComparator<Order>);
+
+    Monomial x({1, 0});
+    Monomial y({0, 1});
+    Monomial xx({2, 0});
+
+    ASSERT_TRUE(Order::IsGreater(y, x));
+    ASSERT_TRUE(Order::IsGreater(xx, y));
+    ASSERT_TRUE(Order::IsLess(x, xx));
+    ASSERT_TRUE(Order::IsGreaterOrEqual(x, x));
+    ASSERT_EQ(Order::GetKey(xx), 2);
+
+    // key follows degree changes
+    xx.SetDegree(1, 3);
+    ASSERT_EQ(Order::GetKey(xx), 8);
+
+    using LexTiebreak = WeightedOrder<Weights<1, 1>, LexOrder>;
+    ASSERT_TRUE(LexTiebreak::IsGreater(x, y));
+    ASSERT_TRUE(LexTiebreak::IsGreater(Monomial({0, 2}), x));
+}
+
+TEST(CompareWeightedOrder, EqualToGraded) {
+    auto monomials = AllMonomials(3, 2);
+    CheckSameOrder<WeightedOrder<Weights<1, 1, 1>, LexOrder>, GrlexOrder>(
+        monomials);
+    CheckSameOrder<WeightedOrder<Weights<1, 1, 1>>, GrevlexOrder>(monomials);
+}
+
+TEST(CompareMatrixOrder, EqualToKnownOrders) {
+    auto monomials = AllMonomials(3, 2);
+    CheckSameOrder<MatrixOrder<Weights<1, 0, 0>>, LexOrder>(monomials);
+    CheckSameOrder<MatrixOrder<Weights<1, 1, 1>>, GrlexOrder>(monomials);
+    CheckSameOrder<MatrixOrder<Weights<1, 1, 1>, Weights<1, 1>, Weights<1>>,
+                   GrevlexOrder>(monomials);
+}
+
+TEST(CompareMatrixOrder, Basic) {
+    using Order = MatrixOrder<Weights<0, 1>, Weights<1>>;
+    static_assert(IsComparator<Order>);
+
+    ASSERT_TRUE(Order::IsGreater(Monomial({0, 1}), Monomial({5, 0})));
+    ASSERT_TRUE(Order::IsGreater(Monomial({1, 1}), Monomial({0, 1})));
+    ASSERT_TRUE(Order::IsLessOrEqual(Monomial({1, 1}), Monomial({1, 1, 0})));
+    Order::Key key = {2, 3};
+    ASSERT_EQ(Order::GetKey(Monomial({3, 2})), key);
+}
+
+TEST(CompareBlockOrder, Basic) {
+    using Order = BlockOrder<1, LexOrder, GrevlexOrder>;
+    static_assert(IsComparator<Order>);
+
+    ASSERT_TRUE(Order::IsGreater(Monomial({1}), Monomial({0, 5, 5})));
+    ASSERT_TRUE(Order::IsGreater(Monomial({1, 1}), Monomial({1, 0, 1})));
+    ASSERT_TRUE(Order::IsGreater(Monomial({1, 2}), Monomial({1, 0, 1})));
+    ASSERT_TRUE(Order::IsGreater(Monomial({0, 1, 1}), Monomial({0, 0, 1})));
+    ASSERT_TRUE(Order::IsGreaterOrEqual(Monomial({2}), Monomial({2, 0})));
+
+    auto monomials = AllMonomials(3, 2);
+    CheckSameOrder<BlockOrder<3, GrlexOrder, LexOrder>, GrlexOrder>(
+        monomials);
+    CheckSameOrder<BlockOrder<0, LexOrder, GrevlexOrder>, GrevlexOrder>(
+        monomials);
+    CheckSameOrder<BlockOrder<1, LexOrder, LexOrder>, LexOrder>(monomials);
+}
+
+TEST(CompareBlockOrder, Polynomial) {
+    using Order = BlockOrder<2, GrlexOrder, GrevlexOrder>;
+    std::vector<RationalTerm> x = {{1, {0, 1, 3}},
+                                   {2, {1, 0, 0, 1}},
+                                   {3, {0, 0, 2, 2}},
+                                   {4, {1, 1}}};
+    Polynomial<Rational, Order> poly(x.begin(), x.end());
+    ASSERT_EQ(poly.GetAt(0), x[3]);
+    ASSERT_EQ(poly.GetAt(1), x[1]);
+    ASSERT_EQ(poly.GetAt(2), x[0]);
+    ASSERT_EQ(poly.GetAt(3), x[2]);
+}
+
+TEST(CompareBlockOrder, Elimination) {
+    // t, x, y: x = t^2, y = t^3 gives x^3 - y^2 after eliminating t
+    using Order = BlockOrder<1, LexOrder, GrevlexOrder>;
+    Polynomial<Rational, Order> f = {{1, {0, 1}}, {-1, {2}}};
+    Polynomial<Rational, Order> g = {{1, {0, 0, 1}}, {-1, {3}}};
+    PolySystem<Rational, Order> system({f, g});
+
+    auto basis = GroebnerAlgorithm::BuildGB(system, AutoReduction::Enabled);
+
+    Polynomial<Rational, Order> expected = {{1, {0, 3}}, {-1, {0, 0, 2}}};
+    bool found = false;
+    for (size_t i = 0; i < basis.GetSize(); i++) {
+        found |= basis[i] == expected;
+    }
+    ASSERT_TRUE(found);
+}
+}  // namespace Groebner::Test
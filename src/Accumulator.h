@@ -0,0 +1,88 @@
+#pragma once
+
+#include "FieldFwd.h"
+
+#include <type_traits>
+
+namespace Groebner::Details {
+// Sum of products a_1 b_1 + a_2 b_2 + ... The generic version adds every
+// product as it comes, prime fields override it below.
+template <IsSupportedField Field>
+class Accumulator {
+    public:
+        void Add(const Field& value) { sum_ += value; }
+        void AddProduct(const Field& lhs, const Field& rhs) {
+            sum_ += lhs * rhs;
+        }
+        void SubProduct(const Field& lhs, const Field& rhs) {
+            sum_ -= lhs * rhs;
+        }
+
+        // no terms were added, or they cancelled
+        bool IsEmpty() const { return sum_.IsZero(); }
+        Field Get() const { return sum_; }
+        void Clear() { sum_ = Field(); }
+
+    private:
+        Field sum_;
+};
+
+template <typename Field>
+inline constexpr bool kIsPrimeFieldV = false;
+
+template <int64_t N>
+inline constexpr bool kIsPrimeFieldV<Modulo<N>> = true;
+
+template <>
+inline constexpr bool kIsPrimeFieldV<RuntimeModulo> = true;
+
+// prime fields whose products of reduced values fit 64 bits
+template <typename Field>
+inline constexpr bool kHasNarrowProductsV = false;
+
+template <int64_t N>
+inline constexpr bool kHasNarrowProductsV<Modulo<N>> =
+    N < static_cast<int64_t>(kBarrettLimit);
+
+// Delayed reduction: products of reduced values are summed unreduced and
+// the sum is reduced once when read, by the field's own Barrett or
+// Montgomery reducer rather than a generic division. Fields with moduli
+// below 2^32 sum in 64 bits, the others in 128 bits, where a product is
+// below 2^126. Before an addition that would overflow, the sum is reduced
+// in place, which for 128 bits never happens in practice.
+template <IsSupportedField Field>
+requires kIsPrimeFieldV<Field>
+class Accumulator<Field> {
+    private:
+        using Sum = std::conditional_t<kHasNarrowProductsV<Field>, uint64_t,
+                                       unsigned __int128>;
+        static constexpr Sum kMaxSum = ~Sum(0);
+
+    public:
+        void Add(const Field& value) {
+            AddUnreduced(static_cast<uint64_t>(value.GetValue()));
+        }
+        void AddProduct(const Field& lhs, const Field& rhs) {
+            AddUnreduced(static_cast<Sum>(lhs.GetValue()) *
+                         static_cast<uint64_t>(rhs.GetValue()));
+        }
+        void SubProduct(const Field& lhs, const Field& rhs) {
+            AddProduct(-lhs, rhs);
+        }
+
+        bool IsEmpty() const { return sum_ == 0; }
+        Field Get() const { return Field::FromUnreduced(sum_); }
+        void Clear() { sum_ = 0; }
+
+    private:
+        // a reduced sum plus any product stays below kMaxSum
+        void AddUnreduced(Sum value) {
+            if (sum_ > kMaxSum - value) [[unlikely]] {
+                sum_ = static_cast<uint64_t>(Get().GetValue());
+            }
+            sum_ += value;
+        }
+
+        Sum sum_ = 0;
+};
+}  // namespace Groebner::Details
@@ -0,0 +1,187 @@
+#include "BigRational.h"
+
+#include <cassert>
+#include <utility>
+
+namespace Groebner {
+
+BigRational::BigRational(Integer::SmallType numerator,
+                         Integer::SmallType denominator)
+    : BigRational(Integer(numerator), Integer(denominator)) {}
+
+BigRational::BigRational(Integer numerator, Integer denominator)
+    : numerator_(std::move(numerator)), denominator_(std::move(denominator)) {
+    assert(!denominator_.IsZero() && "Denominator must not be zero");
+    Reduce();
+}
+
+BigRational::BigRational(const Rational& value)
+    : numerator_(value.GetNumerator()), denominator_(value.GetDenominator()) {}
+
+BigRational BigRational::operator-() const {
+    BigRational result(*this);
+    result.numerator_ = -result.numerator_;
+    return result;
+}
+
+BigRational BigRational::operator+() const {
+    return *this;
+}
+
+BigRational BigRational::Abs() const {
+    return numerator_.GetSign() < 0 ? -*this : *this;
+}
+
+BigRational& BigRational::operator+=(const BigRational& other) {
+    return Add(other, false);
+}
+
+BigRational& BigRational::operator-=(const BigRational& other) {
+    return Add(other, true);
+}
+
+// gcds of the crossed parts are taken before multiplying,
+// so the product is reduced and the numbers stay small
+BigRational& BigRational::operator*=(const BigRational& other) {
+    if (IsZero() || other.IsZero()) {
+        *this = BigRational();
+        return *this;
+    }
+    if (denominator_ == 1 && other.denominator_ == 1) {
+        numerator_ *= other.numerator_;
+        return *this;
+    }
+
+    Integer lhs_gcd = Gcd(numerator_, other.denominator_);
+    Integer rhs_gcd = Gcd(other.numerator_, denominator_);
+    Integer numerator = (numerator_ / lhs_gcd) * (other.numerator_ / rhs_gcd);
+    denominator_ =
+        (denominator_ / rhs_gcd) * (other.denominator_ / lhs_gcd);
+    numerator_ = std::move(numerator);
+    return *this;
+}
+
+BigRational& BigRational::operator/=(const BigRational& other) {
+    assert(!other.IsZero() && "Can't divide by zero");
+    if (IsZero()) {
+        return *this;
+    }
+
+    // self-division case
+    Integer other_numerator = other.numerator_;
+    Integer lhs_gcd = Gcd(numerator_, other_numerator);
+    Integer rhs_gcd = Gcd(other.denominator_, denominator_);
+    numerator_ = (numerator_ / lhs_gcd) * (other.denominator_ / rhs_gcd);
+    denominator_ = (denominator_ / rhs_gcd) * (other_numerator / lhs_gcd);
+    if (denominator_.GetSign() < 0) {
+        numerator_ = -numerator_;
+        denominator_ = -denominator_;
+    }
+    return *this;
+}
+
+BigRational BigRational::operator+(const BigRational& other) const {
+    BigRational temp(*this);
+    temp += other;
+    return temp;
+}
+
+BigRational BigRational::operator-(const BigRational& other) const {
+    BigRational temp(*this);
+    temp -= other;
+    return temp;
+}
+
+BigRational BigRational::operator*(const BigRational& other) const {
+    BigRational temp(*this);
+    temp *= other;
+    return temp;
+}
+
+BigRational BigRational::operator/(const BigRational& other) const {
+    BigRational temp(*this);
+    temp /= other;
+    return temp;
+}
+
+bool BigRational::operator==(const BigRational& other) const {
+    return numerator_ == other.numerator_ && denominator_ == other.denominator_;
+}
+
+bool BigRational::operator!=(const BigRational& other) const {
+    return !(*this == other);
+}
+
+bool BigRational::operator<(const BigRational& other) const {
+    return numerator_ * other.denominator_ < other.numerator_ * denominator_;
+}
+
+bool BigRational::operator<=(const BigRational& other) const {
+    return (*this < other) || (*this == other);
+}
+
+bool BigRational::operator>(const BigRational& other) const {
+    return other < *this;
+}
+
+bool BigRational::operator>=(const BigRational& other) const {
+    return other <= *this;
+}
+
+void BigRational::Reduce() {
+    assert(!denominator_.IsZero() && "Denominator must not be zero");
+    if (numerator_.IsZero()) {
+        denominator_ = 1;
+        return;
+    }
+
+    if (denominator_.GetSign() < 0) {
+        numerator_ = -numerator_;
+        denominator_ = -denominator_;
+    }
+
+    Integer gcd = Gcd(numerator_, denominator_);
+    if (gcd != 1) {
+        numerator_ /= gcd;
+        denominator_ /= gcd;
+    }
+}
+
+// a/b + c/d with g = gcd(b, d): the sum is t / (b/g * d) for
+// t = a * d/g + c * b/g, and only gcd(t, g) can still cancel out
+BigRational& BigRational::Add(const BigRational& other, bool is_subtraction) {
+    if (denominator_ == 1 && other.denominator_ == 1) {
+        if (is_subtraction) {
+            numerator_ -= other.numerator_;
+        } else {
+            numerator_ += other.numerator_;
+        }
+        return *this;
+    }
+
+    Integer gcd = Gcd(denominator_, other.denominator_);
+    Integer lhs_factor = other.denominator_ / gcd;
+    Integer rhs_factor = denominator_ / gcd;
+    Integer numerator = numerator_ * lhs_factor;
+    if (is_subtraction) {
+        numerator -= other.numerator_ * rhs_factor;
+    } else {
+        numerator += other.numerator_ * rhs_factor;
+    }
+
+    if (numerator.IsZero()) {
+        *this = BigRational();
+        return *this;
+    }
+    Integer common = Gcd(numerator, gcd);
+    if (common != 1) {
+        numerator /= common;
+        denominator_ = rhs_factor * (other.denominator_ / common);
+    } else {
+        denominator_ = rhs_factor * other.denominator_;
+    }
+    numerator_ = std::move(numerator);
+    return *this;
+}
+
+}  // namespace Groebner
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Integer.h"
+#include "Rational.h"
+
+namespace Groebner {
+
+// Rational number with arbitrary-precision numerator and denominator,
+// exact where Rational would overflow. While the parts fit int64_t
+// all arithmetic runs on machine integers.
+class BigRational {
+    public:
+        using ValueType = Integer;
+
+        BigRational(Integer::SmallType numerator = 0,
+                    Integer::SmallType denominator = 1);
+        BigRational(Integer numerator, Integer denominator = Integer(1));
+        explicit BigRational(const Rational& value);
+
+        const Integer& GetNumerator() const { return numerator_; }
+        const Integer& GetDenominator() const { return denominator_; }
+
+        BigRational operator-() const;
+        BigRational operator+() const;
+
+        bool IsZero() const { return numerator_.IsZero(); }
+        BigRational Abs() const;
+
+        BigRational& operator+=(const BigRational& other);
+        BigRational& operator-=(const BigRational& other);
+        BigRational& operator*=(const BigRational& other);
+        BigRational& operator/=(const BigRational& other);
+
+        BigRational operator+(const BigRational& other) const;
+        BigRational operator-(const BigRational& other) const;
+        BigRational operator*(const BigRational& other) const;
+        BigRational operator/(const BigRational& other) const;
+
+        bool operator==(const BigRational& other) const;
+        bool operator!=(const BigRational& other) const;
+        bool operator<(const BigRational& other) const;
+        bool operator<=(const BigRational& other) const;
+        bool operator>(const BigRational& other) const;
+        bool operator>=(const BigRational& other) const;
+
+    private:
+        void Reduce();
+        BigRational& Add(const BigRational& other, bool is_subtraction);
+
+        // same invariants as Rational:
+        // denominator > 0, gcd(numerator, denominator) = 1, zero is 0 / 1
+        Integer numerator_;
+        Integer denominator_ = 1;
+};
+
+}  // namespace Groebner
@@ -0,0 +1,93 @@
+#include "BitMatrix.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+
+namespace Groebner {
+
+BitMatrix::BitMatrix(size_t rows_count, size_t cols_count)
+    : rows_count_(rows_count),
+      cols_count_(cols_count),
+      words_per_row_((cols_count + kWordBits - 1) / kWordBits),
+      words_(rows_count * words_per_row_) {}
+
+void BitMatrix::Set(size_t row, size_t col, bool value) {
+    assert(col < cols_count_ && "Out of bounds");
+    WordType bit = WordType(1) << (col % kWordBits);
+    WordType& word = GetRowData(row)[col / kWordBits];
+    word = value ? word | bit : word & ~bit;
+}
+
+void BitMatrix::Flip(size_t row, size_t col) {
+    assert(col < cols_count_ && "Out of bounds");
+    GetRowData(row)[col / kWordBits] ^= WordType(1) << (col % kWordBits);
+}
+
+std::span<const BitMatrix::WordType> BitMatrix::GetRow(size_t row) const {
+    assert(row < rows_count_ && "Out of bounds");
+    return {words_.data() + row * words_per_row_, words_per_row_};
+}
+
+BitMatrix::WordType* BitMatrix::GetRowData(size_t row) {
+    assert(row < rows_count_ && "Out of bounds");
+    return words_.data() + row * words_per_row_;
+}
+
+void BitMatrix::AddRow(size_t target, size_t source) {
+    assert(target != source && "Row would be cleared");
+    WordType* __restrict dest = GetRowData(target);
+    const WordType* __restrict src = GetRowData(source);
+    for (size_t i = 0; i < words_per_row_; i++) {
+        dest[i] ^= src[i];
+    }
+}
+
+void BitMatrix::SwapRows(size_t lhs, size_t rhs) {
+    if (lhs != rhs) {
+        std::swap_ranges(GetRowData(lhs), GetRowData(lhs) + words_per_row_,
+                         GetRowData(rhs));
+    }
+}
+
+size_t BitMatrix::FindPivot(size_t row) const {
+    auto words = GetRow(row);
+    for (size_t i = 0; i < words.size(); i++) {
+        if (words[i] != 0) {
+            return i * kWordBits + std::countr_zero(words[i]);
+        }
+    }
+    return cols_count_;
+}
+
+size_t BitMatrix::Eliminate() {
+    size_t rank = 0;
+    for (size_t col = 0; col < cols_count_ && rank < rows_count_; col++) {
+        size_t word = col / kWordBits;
+        WordType bit = WordType(1) << (col % kWordBits);
+        size_t pivot = rank;
+        while (pivot < rows_count_ && !(GetRowData(pivot)[word] & bit)) {
+            pivot++;
+        }
+        if (pivot == rows_count_) {
+            continue;
+        }
+        SwapRows(rank, pivot);
+
+        // the pivot row is zero before col, words before it stay as they are
+        const WordType* __restrict src = GetRowData(rank);
+        for (size_t row = 0; row < rows_count_; row++) {
+            WordType* __restrict dest = GetRowData(row);
+            if (row == rank || !(dest[word] & bit)) {
+                continue;
+            }
+            for (size_t i = word; i < words_per_row_; i++) {
+                dest[i] ^= src[i];
+            }
+        }
+        rank++;
+    }
+    return rank;
+}
+
+}  // namespace Groebner
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cinttypes>
+#include <span>
+#include <vector>
+
+namespace Groebner {
+
+// Dense matrix over GF(2), every row is packed into 64-bit words, so
+// adding one row to another is a XOR of words; the loop has no
+// dependencies and is vectorized by the compiler where SIMD is available.
+class BitMatrix {
+    public:
+        using WordType = uint64_t;
+        static constexpr size_t kWordBits = 64;
+
+        BitMatrix(size_t rows_count = 0, size_t cols_count = 0);
+
+        size_t GetRowsCount() const { return rows_count_; }
+        size_t GetColsCount() const { return cols_count_; }
+
+        bool Get(size_t row, size_t col) const {
+            return (GetRow(row)[col / kWordBits] >> (col % kWordBits)) & 1;
+        }
+        void Set(size_t row, size_t col, bool value);
+        void Flip(size_t row, size_t col);
+
+        // bit col of the row is bit col % 64 of word col / 64,
+        // bits past the last column are zero
+        std::span<const WordType> GetRow(size_t row) const;
+
+        // row target += row source
+        void AddRow(size_t target, size_t source);
+        void SwapRows(size_t lhs, size_t rhs);
+
+        // first column with a set bit, GetColsCount() for a zero row
+        size_t FindPivot(size_t row) const;
+
+        // Gauss-Jordan elimination to the reduced row echelon form,
+        // returns the rank r: rows [0, r) have pivots in increasing
+        // columns, nothing else is set in a pivot column, the rest is zero
+        size_t Eliminate();
+
+    private:
+        WordType* GetRowData(size_t row);
+
+        size_t rows_count_;
+        size_t cols_count_;
+        size_t words_per_row_;
+        // rows one after another, words_per_row_ words each
+        std::vector<WordType> words_;
+};
+
+}  // namespace Groebner
@@ -2,6 +2,7 @@
 
 #include "ListFwd.h"
 #include "MonomialCompare.h"
+#include "WeightedOrder.h"
 
 #include <type_traits>
 
@@ -9,8 +10,21 @@ namespace Groebner {
 namespace Details {
     using Comparators =
         List<LexOrder, GrlexOrder, GrevlexOrder>;
-}
+
+    template <typename T>
+    constexpr inline bool IsComparatorV = IsInList<T, Comparators>;
+
+    template <typename Row, typename Tiebreak>
+    constexpr inline bool IsComparatorV<WeightedOrder<Row, Tiebreak>> = true;
+
+    template <size_t Split, typename First, typename Second>
+    constexpr inline bool IsComparatorV<BlockOrder<Split, First, Second>> =
+        true;
+
+    template <typename... Rows>
+    constexpr inline bool IsComparatorV<MatrixOrder<Rows...>> = true;
+}  // namespace Details
 
 template <typename T>
-concept IsComparator = Details::IsInList<T, Details::Comparators>;
+concept IsComparator = Details::IsComparatorV<T>;
 }  // namespace Groebner
@@ -0,0 +1,310 @@
+#pragma once
+
+#include "Accumulator.h"
+#include "PolySystem.h"
+#include "Polynomial.h"
+
+#include <algorithm>
+#include <cassert>
+#include <span>
+#include <vector>
+
+namespace Groebner {
+
+// Points stored by variable: the values of one variable at all points are
+// contiguous, so evaluation loops run over points with unit stride.
+template <IsSupportedField Field>
+class PointBatch {
+    public:
+        PointBatch(size_t vars, size_t count)
+            : vars_(vars), count_(count), values_(vars * count) {}
+
+        // missing trailing coordinates are zeros
+        explicit PointBatch(const std::vector<std::vector<Field>>& points)
+            : PointBatch(GetMaxSize(points), points.size()) {
+            for (size_t point = 0; point < count_; point++) {
+                for (size_t var = 0; var < points[point].size(); var++) {
+                    values_[var * count_ + point] = points[point][var];
+                }
+            }
+        }
+
+        size_t GetVarsCount() const { return vars_; }
+        size_t GetSize() const { return count_; }
+
+        std::span<const Field> GetVariable(size_t var) const {
+            assert(var < vars_ && "Out of bounds");
+            return {values_.data() + var * count_, count_};
+        }
+        std::span<Field> GetVariable(size_t var) {
+            assert(var < vars_ && "Out of bounds");
+            return {values_.data() + var * count_, count_};
+        }
+
+        std::vector<Field> GetPoint(size_t point) const {
+            assert(point < count_ && "Out of bounds");
+            std::vector<Field> result(vars_);
+            for (size_t var = 0; var < vars_; var++) {
+                result[var] = values_[var * count_ + point];
+            }
+            return result;
+        }
+
+    private:
+        static size_t GetMaxSize(const std::vector<std::vector<Field>>& points) {
+            size_t result = 0;
+            for (const auto& point : points) {
+                result = std::max(result, point.size());
+            }
+            return result;
+        }
+
+        size_t vars_;
+        size_t count_;
+        std::vector<Field> values_;
+};
+
+namespace Details {
+    // points evaluated together, the power tables of a block stay in cache
+    constexpr inline size_t kEvaluationBlock = 256;
+
+    // base^exponent by repeated squaring
+    template <IsSupportedField Field>
+    Field Power(Field base, Monomial::DegreeType exponent) {
+        Field result = 1;
+        for (; exponent > 0; exponent >>= 1) {
+            if (exponent & 1) {
+                result *= base;
+            }
+            if (exponent > 1) {
+                base *= base;
+            }
+        }
+        return result;
+    }
+
+    // sorted distinct positive exponents of every variable
+    using ExponentSets = std::vector<std::vector<Monomial::DegreeType>>;
+
+    // Powers x_v^e for the exponents e of x_v that occur in the input, for
+    // a block of points. Every power is a row of kEvaluationBlock values,
+    // so a term is a product of rows and the sum over terms accumulates
+    // row by row. A row is the previous one times x_v^gap, where the gap
+    // to the previous exponent is raised by squaring unless it is one, so
+    // sparse high degrees cost neither memory nor a multiplication per
+    // skipped exponent.
+    template <IsSupportedField Field>
+    class PowerTable {
+        public:
+            explicit PowerTable(const ExponentSets& exponents)
+                : offsets_(exponents.size() + 1) {
+                for (size_t var = 0; var < exponents.size(); var++) {
+                    offsets_[var + 1] = offsets_[var] + exponents[var].size();
+                    exponents_.insert(exponents_.end(), exponents[var].begin(),
+                                      exponents[var].end());
+                }
+                rows_.resize(offsets_.back() * kEvaluationBlock);
+                product_.resize(kEvaluationBlock);
+                sums_.resize(kEvaluationBlock);
+            }
+
+            void Load(const PointBatch<Field>& points, size_t begin,
+                      size_t end) {
+                size_t count = end - begin;
+                for (size_t var = 0; var + 1 < offsets_.size(); var++) {
+                    if (offsets_[var] == offsets_[var + 1]) {
+                        continue;
+                    }
+                    assert(var < points.GetVarsCount() &&
+                           "Point has fewer coordinates than variables");
+                    auto values = points.GetVariable(var).subspan(begin, count);
+                    Field* row =
+                        rows_.data() + offsets_[var] * kEvaluationBlock;
+                    Monomial::DegreeType first = exponents_[offsets_[var]];
+                    for (size_t i = 0; i < count; i++) {
+                        row[i] = Power(values[i], first);
+                    }
+                    for (size_t k = offsets_[var] + 1; k < offsets_[var + 1];
+                         k++) {
+                        Monomial::DegreeType gap =
+                            exponents_[k] - exponents_[k - 1];
+                        Field* next = row + kEvaluationBlock;
+                        if (gap == 1) {
+                            for (size_t i = 0; i < count; i++) {
+                                next[i] = row[i] * values[i];
+                            }
+                        } else {
+                            for (size_t i = 0; i < count; i++) {
+                                next[i] = row[i] * Power(values[i], gap);
+                            }
+                        }
+                        row = next;
+                    }
+                }
+                count_ = count;
+            }
+
+            // Adds poly at the loaded points to out[0, count). The last
+            // factor of every term goes into a per point accumulator,
+            // which is reduced once per polynomial.
+            template <IsComparator Comparator>
+            void Accumulate(const Polynomial<Field, Comparator>& poly,
+                            Field* out) {
+                Field* product = product_.data();
+                for (const auto& [degree, coef] : poly) {
+                    auto degrees = degree.GetDegrees();
+                    size_t last = degrees.size();
+                    while (last > 0 && degrees[last - 1] == 0) {
+                        last--;
+                    }
+                    if (last == 0) {
+                        for (size_t i = 0; i < count_; i++) {
+                            sums_[i].Add(coef);
+                        }
+                        continue;
+                    }
+
+                    bool is_first = true;
+                    for (size_t var = 0; var + 1 < last; var++) {
+                        if (degrees[var] == 0) {
+                            continue;
+                        }
+                        const Field* row = GetRow(var, degrees[var]);
+                        if (is_first) {
+                            for (size_t i = 0; i < count_; i++) {
+                                product[i] = row[i] * coef;
+                            }
+                            is_first = false;
+                        } else {
+                            for (size_t i = 0; i < count_; i++) {
+                                product[i] *= row[i];
+                            }
+                        }
+                    }
+
+                    const Field* row = GetRow(last - 1, degrees[last - 1]);
+                    if (is_first) {
+                        for (size_t i = 0; i < count_; i++) {
+                            sums_[i].AddProduct(row[i], coef);
+                        }
+                    } else {
+                        for (size_t i = 0; i < count_; i++) {
+                            sums_[i].AddProduct(row[i], product[i]);
+                        }
+                    }
+                }
+
+                for (size_t i = 0; i < count_; i++) {
+                    out[i] += sums_[i].Get();
+                    sums_[i].Clear();
+                }
+            }
+
+        private:
+            Field* GetRow(size_t var, Monomial::DegreeType degree) {
+                auto first = exponents_.begin() + offsets_[var];
+                auto last = exponents_.begin() + offsets_[var + 1];
+                auto it = std::lower_bound(first, last, degree);
+                assert(it != last && *it == degree && "Exponent not loaded");
+                return rows_.data() +
+                       (it - exponents_.begin()) * kEvaluationBlock;
+            }
+
+            std::vector<size_t> offsets_;
+            std::vector<Monomial::DegreeType> exponents_;
+            std::vector<Field> rows_;
+            std::vector<Field> product_;
+            std::vector<Accumulator<Field>> sums_;
+            size_t count_ = 0;
+    };
+
+    template <IsSupportedField Field, IsComparator Comparator>
+    void CollectExponents(const Polynomial<Field, Comparator>& poly,
+                          ExponentSets& exponents) {
+        for (const auto& [degree, coef] : poly) {
+            auto degrees = degree.GetDegrees();
+            if (exponents.size() < degrees.size()) {
+                exponents.resize(degrees.size());
+            }
+            for (size_t var = 0; var < degrees.size(); var++) {
+                if (degrees[var] > 0) {
+                    exponents[var].push_back(degrees[var]);
+                }
+            }
+        }
+    }
+
+    inline void SortExponents(ExponentSets& exponents) {
+        for (auto& set : exponents) {
+            std::sort(set.begin(), set.end());
+            set.erase(std::unique(set.begin(), set.end()), set.end());
+        }
+    }
+}  // namespace Details
+
+// values of poly at every point of the batch
+template <IsSupportedField Field, IsComparator Comparator>
+std::vector<Field> Evaluate(const Polynomial<Field, Comparator>& poly,
+                            const PointBatch<Field>& points) {
+    Details::ExponentSets exponents;
+    Details::CollectExponents(poly, exponents);
+    Details::SortExponents(exponents);
+    Details::PowerTable<Field> table(exponents);
+
+    std::vector<Field> result(points.GetSize());
+    for (size_t begin = 0; begin < points.GetSize();
+         begin += Details::kEvaluationBlock) {
+        size_t end =
+            std::min(begin + Details::kEvaluationBlock, points.GetSize());
+        table.Load(points, begin, end);
+        table.Accumulate(poly, result.data() + begin);
+    }
+    return result;
+}
+
+// result[i][j] is system[i] at point j, powers are shared by the system
+template <IsSupportedField Field, IsComparator Comparator>
+std::vector<std::vector<Field>> Evaluate(
+    const PolySystem<Field, Comparator>& system,
+    const PointBatch<Field>& points) {
+    Details::ExponentSets exponents;
+    for (size_t i = 0; i < system.GetSize(); i++) {
+        Details::CollectExponents(system[i], exponents);
+    }
+    Details::SortExponents(exponents);
+    Details::PowerTable<Field> table(exponents);
+
+    std::vector<std::vector<Field>> result(
+        system.GetSize(), std::vector<Field>(points.GetSize()));
+    for (size_t begin = 0; begin < points.GetSize();
+         begin += Details::kEvaluationBlock) {
+        size_t end =
+            std::min(begin + Details::kEvaluationBlock, points.GetSize());
+        table.Load(points, begin, end);
+        for (size_t i = 0; i < system.GetSize(); i++) {
+            table.Accumulate(system[i], result[i].data() + begin);
+        }
+    }
+    return result;
+}
+
+// value of poly at a single point
+template <IsSupportedField Field, IsComparator Comparator>
+Field Evaluate(const Polynomial<Field, Comparator>& poly,
+               std::span<const Field> point) {
+    Field result = 0;
+    for (const auto& [degree, coef] : poly) {
+        auto degrees = degree.GetDegrees();
+        Field value = coef;
+        for (size_t var = 0; var < degrees.size(); var++) {
+            assert((degrees[var] == 0 || var < point.size()) &&
+                   "Point has fewer coordinates than variables");
+            if (degrees[var] > 0) {
+                value *= Details::Power(point[var], degrees[var]);
+            }
+        }
+        result += value;
+    }
+    return result;
+}
+}  // namespace Groebner
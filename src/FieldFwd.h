@@ -1,20 +1,28 @@
 #pragma once
 
+#include "BigRational.h"
+#include "GaloisField.h"
+#include "Gf2.h"
 #include "ListFwd.h"
 #include "Modulo.h"
 #include "Rational.h"
+#include "RuntimeModulo.h"
 
 #include <type_traits>
 
 namespace Groebner {
 namespace Details {
-    using SupportedFields = List<Rational>;
+    using SupportedFields = List<Rational, BigRational, RuntimeModulo, Gf2>;
 
     template <typename T>
     constexpr inline bool IsSupportedFieldV = IsInList<T, SupportedFields>;
 
     template <int64_t N>
     constexpr inline bool IsSupportedFieldV<Modulo<N>> = IsPrime(N);
+
+    template <int64_t P, size_t K>
+    constexpr inline bool IsSupportedFieldV<GaloisField<P, K>> =
+        IsPrime(P) && K >= 1;
 }  // namespace Details
 
 template <typename T>
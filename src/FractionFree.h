@@ -0,0 +1,76 @@
+#pragma once
+
+#include "FieldFwd.h"
+#include "Polynomial.h"
+
+#include <cassert>
+#include <numeric>
+
+namespace Groebner::Details {
+// fields of fractions of the integers, their polynomials can be kept
+// with integer coefficients
+template <typename Field>
+inline constexpr bool kIsFractionFieldV = false;
+
+template <>
+inline constexpr bool kIsFractionFieldV<Rational> = true;
+
+template <>
+inline constexpr bool kIsFractionFieldV<BigRational> = true;
+
+inline int64_t GetGcd(int64_t lhs, int64_t rhs) {
+    return std::gcd(lhs, rhs);
+}
+
+inline Integer GetGcd(const Integer& lhs, const Integer& rhs) {
+    return Gcd(lhs, rhs);
+}
+
+// gcd of the numerators, positive for a non-zero polynomial
+// with integer coefficients
+template <IsSupportedField Field, IsComparator Comparator>
+requires kIsFractionFieldV<Field>
+typename Field::ValueType GetContent(const Polynomial<Field, Comparator>& poly) {
+    typename Field::ValueType content = 0;
+    for (const auto& [degree, coef] : poly) {
+        assert(coef.GetDenominator() == 1 && "Coefficients must be integers");
+        content = GetGcd(content, coef.GetNumerator());
+        if (content == 1) {
+            break;
+        }
+    }
+    return content;
+}
+
+// divides every coefficient by a common divisor of them
+template <IsSupportedField Field, IsComparator Comparator>
+requires kIsFractionFieldV<Field>
+void RemoveContent(Polynomial<Field, Comparator>& poly,
+                   const typename Field::ValueType& content) {
+    if (content != 1 && content != 0) {
+        poly.ScaleCoefs(Field(1) / Field(content));
+    }
+}
+
+// the integer polynomial with coprime coefficients and a positive
+// leader that is a rational multiple of poly
+template <IsSupportedField Field, IsComparator Comparator>
+requires kIsFractionFieldV<Field>
+void MakePrimitive(Polynomial<Field, Comparator>& poly) {
+    if (poly.IsZero()) {
+        return;
+    }
+    typename Field::ValueType denominator = 1;
+    for (const auto& [degree, coef] : poly) {
+        const auto& current = coef.GetDenominator();
+        denominator = denominator / GetGcd(denominator, current) * current;
+    }
+    if (denominator != 1) {
+        poly.ScaleCoefs(Field(denominator));
+    }
+    RemoveContent(poly, GetContent(poly));
+    if (poly.GetLeaderCoef() < Field(0)) {
+        poly.ScaleCoefs(Field(-1));
+    }
+}
+}  // namespace Groebner::Details
@@ -0,0 +1,251 @@
+#include "GaloisField.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace Groebner::Details {
+namespace {
+    // polynomials below have no leading zeros, zero is empty
+
+    // candidate coefficients are taken below this bound, so for large p
+    // the lower coefficients vary together instead of the constant alone
+    constexpr int64_t kSearchBase = 16;
+
+    void Trim(FieldPolynomial& poly) {
+        while (!poly.empty() && poly.back() == 0) {
+            poly.pop_back();
+        }
+    }
+
+    int64_t InverseModulo(int64_t value, int64_t p) {
+        return static_cast<int64_t>(PowerModulo(value, p - 2, p));
+    }
+
+    int64_t SubModulo(int64_t lhs, int64_t rhs, int64_t p) {
+        int64_t result = lhs - rhs;
+        return result < 0 ? result + p : result;
+    }
+
+    // lhs -= factor * x^shift * rhs
+    void SubMultiple(FieldPolynomial& lhs, const FieldPolynomial& rhs,
+                     int64_t factor, size_t shift, int64_t p) {
+        if (lhs.size() < rhs.size() + shift) {
+            lhs.resize(rhs.size() + shift);
+        }
+        for (size_t i = 0; i < rhs.size(); i++) {
+            int64_t product =
+                static_cast<int64_t>(MultiplyModulo(factor, rhs[i], p));
+            lhs[i + shift] = SubModulo(lhs[i + shift], product, p);
+        }
+        Trim(lhs);
+    }
+
+    // lhs = quotient * rhs + remainder, rhs is non-zero
+    FieldPolynomial Divide(FieldPolynomial& lhs, const FieldPolynomial& rhs,
+                           int64_t p) {
+        assert(!rhs.empty() && "Can't divide by zero");
+        int64_t leader_inverse = InverseModulo(rhs.back(), p);
+        FieldPolynomial quotient;
+        while (lhs.size() >= rhs.size()) {
+            size_t shift = lhs.size() - rhs.size();
+            int64_t factor = static_cast<int64_t>(
+                MultiplyModulo(lhs.back(), leader_inverse, p));
+            if (quotient.empty()) {
+                quotient.resize(shift + 1);
+            }
+            quotient[shift] = factor;
+            SubMultiple(lhs, rhs, factor, shift, p);
+        }
+        return quotient;
+    }
+
+    FieldPolynomial MultiplyPolynomials(const FieldPolynomial& lhs,
+                                        const FieldPolynomial& rhs,
+                                        const FieldPolynomial& modulus,
+                                        int64_t p) {
+        if (lhs.empty() || rhs.empty()) {
+            return {};
+        }
+        FieldPolynomial product(lhs.size() + rhs.size() - 1);
+        for (size_t i = 0; i < lhs.size(); i++) {
+            for (size_t j = 0; j < rhs.size(); j++) {
+                product[i + j] = static_cast<int64_t>(
+                    (MultiplyModulo(lhs[i], rhs[j], p) + product[i + j]) % p);
+            }
+        }
+        Trim(product);
+        Divide(product, modulus, p);
+        return product;
+    }
+
+    FieldPolynomial PowerPolynomial(FieldPolynomial base, int64_t exponent,
+                                    const FieldPolynomial& modulus,
+                                    int64_t p) {
+        FieldPolynomial result = {1};
+        for (; exponent > 0; exponent >>= 1) {
+            if (exponent & 1) {
+                result = MultiplyPolynomials(result, base, modulus, p);
+            }
+            base = MultiplyPolynomials(base, base, modulus, p);
+        }
+        return result;
+    }
+
+    FieldPolynomial Gcd(FieldPolynomial lhs, FieldPolynomial rhs, int64_t p) {
+        while (!rhs.empty()) {
+            Divide(lhs, rhs, p);
+            std::swap(lhs, rhs);
+        }
+        return lhs;
+    }
+
+    // Ben-Or: f of degree k is irreducible iff it shares no factor with
+    // x^{p^i} - x for i <= k / 2, the product of all irreducibles of
+    // degree dividing i
+    bool IsIrreducible(const FieldPolynomial& poly, int64_t p) {
+        size_t degree = poly.size() - 1;
+        FieldPolynomial power = {0, 1};
+        for (size_t i = 1; i <= degree / 2; i++) {
+            power = PowerPolynomial(power, p, poly, p);
+            FieldPolynomial difference = power;
+            SubMultiple(difference, {1}, 1, 1, p);
+            if (Gcd(poly, difference, p).size() > 1) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // code sum c_i p^i of a polynomial of degree below k and back
+    uint32_t Encode(const FieldPolynomial& poly, int64_t p) {
+        uint32_t code = 0;
+        for (size_t i = poly.size(); i-- > 0;) {
+            code = static_cast<uint32_t>(code * p + poly[i]);
+        }
+        return code;
+    }
+
+    FieldPolynomial Decode(uint32_t code, int64_t p) {
+        FieldPolynomial poly;
+        for (; code > 0; code /= p) {
+            poly.push_back(code % p);
+        }
+        Trim(poly);
+        return poly;
+    }
+}  // namespace
+
+FieldPolynomial FindIrreduciblePolynomial(int64_t p, size_t k) {
+    assert(k >= 1);
+    int64_t base = std::min(p, kSearchBase);
+    // lower coefficients are the digits of candidate in base
+    for (uint64_t candidate = 0;; candidate++) {
+        FieldPolynomial poly(k + 1);
+        poly[k] = 1;
+        uint64_t digits = candidate;
+        for (size_t i = 0; i < k; i++, digits /= base) {
+            poly[i] = static_cast<int64_t>(digits % base);
+        }
+        assert(digits == 0 && "No irreducible polynomial found");
+        if (IsIrreducible(poly, p)) {
+            return poly;
+        }
+    }
+}
+
+// extended Euclid, invariant: remainder = coef * value mod modulus
+FieldPolynomial InvertPolynomial(const FieldPolynomial& value,
+                                 const FieldPolynomial& modulus, int64_t p) {
+    FieldPolynomial old_remainder = modulus, remainder = value;
+    Trim(remainder);
+    assert(!remainder.empty() && "No inverse element for zero");
+    FieldPolynomial old_coef, coef = {1};
+    while (remainder.size() > 1) {
+        FieldPolynomial quotient = Divide(old_remainder, remainder, p);
+        std::swap(old_remainder, remainder);
+        // old_coef - quotient * coef
+        FieldPolynomial next = old_coef;
+        for (size_t i = 0; i < quotient.size(); i++) {
+            if (quotient[i] != 0) {
+                SubMultiple(next, coef, quotient[i], i, p);
+            }
+        }
+        old_coef = std::exchange(coef, std::move(next));
+    }
+    assert(!remainder.empty() && "Modulus is not irreducible");
+    int64_t factor = InverseModulo(remainder[0], p);
+    for (auto& c : coef) {
+        c = static_cast<int64_t>(MultiplyModulo(c, factor, p));
+    }
+    Divide(coef, modulus, p);
+    coef.resize(modulus.size() - 1);
+    return coef;
+}
+
+ExtensionTables BuildExtensionTables(int64_t p,
+                                     const FieldPolynomial& modulus) {
+    int64_t order = GetFieldOrder(p, modulus.size() - 1);
+    assert(order > 1 && order <= kExtensionTableLimit);
+    ExtensionTables tables;
+    tables.log.assign(order, 0);
+    tables.antilog.resize(2 * (order - 1));
+
+    // the first element of order q - 1 by code generates the group
+    for (uint32_t generator = 1;; generator++) {
+        assert(generator < order && "No generator found");
+        FieldPolynomial element = {1};
+        FieldPolynomial power = Decode(generator, p);
+        int64_t exponent = 0;
+        do {
+            tables.antilog[exponent++] = Encode(element, p);
+            element = MultiplyPolynomials(element, power, modulus, p);
+        } while (element != FieldPolynomial{1});
+        if (exponent == order - 1) {
+            break;
+        }
+    }
+
+    for (int64_t i = 0; i < order - 1; i++) {
+        tables.antilog[i + order - 1] = tables.antilog[i];
+        tables.log[tables.antilog[i]] = static_cast<uint32_t>(i);
+    }
+
+    // 1 + g^n only changes the constant coefficient
+    tables.zech.resize(order - 1);
+    for (int64_t n = 0; n < order - 1; n++) {
+        uint32_t code = tables.antilog[n];
+        uint32_t constant = code % p;
+        uint32_t sum = code - constant + (constant + 1) % p;
+        tables.zech[n] =
+            sum == 0 ? static_cast<uint32_t>(order - 1) : tables.log[sum];
+    }
+    return tables;
+}
+
+std::vector<FieldPolynomial> BuildReductionTable(
+    int64_t p, const FieldPolynomial& modulus) {
+    size_t k = modulus.size() - 1;
+    std::vector<FieldPolynomial> table;
+    // x^k = -(f_0 + ... + f_{k-1} x^{k-1})
+    FieldPolynomial power(k);
+    for (size_t i = 0; i < k; i++) {
+        power[i] = SubModulo(0, modulus[i], p);
+    }
+    for (size_t j = k; j + 1 < 2 * k; j++) {
+        table.push_back(power);
+        // times x, the coefficient of x^k is folded back
+        int64_t top = power[k - 1];
+        for (size_t i = k - 1; i > 0; i--) {
+            power[i] = power[i - 1];
+        }
+        power[0] = 0;
+        for (size_t i = 0; i < k; i++) {
+            int64_t product =
+                static_cast<int64_t>(MultiplyModulo(top, modulus[i], p));
+            power[i] = SubModulo(power[i], product, p);
+        }
+    }
+    return table;
+}
+
+}  // namespace Groebner::Details
@@ -0,0 +1,375 @@
+#pragma once
+
+#include "Modulo.h"
+
+#include <array>
+#include <cassert>
+#include <cinttypes>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace Groebner {
+namespace Details {
+    // coefficients mod p, lowest degree first
+    using FieldPolynomial = std::vector<int64_t>;
+
+    // p^k, or 0 when it does not fit int64_t
+    constexpr int64_t GetFieldOrder(int64_t p, size_t k) {
+        int64_t order = 1;
+        for (size_t i = 0; i < k; i++) {
+            if (__builtin_mul_overflow(order, p, &order)) {
+                return 0;
+            }
+        }
+        return order;
+    }
+
+    // the first monic irreducible polynomial of degree k over F_p,
+    // candidates are tried in a fixed order, so the result is stable
+    FieldPolynomial FindIrreduciblePolynomial(int64_t p, size_t k);
+
+    // value^{-1} modulo the irreducible modulus, value is non-zero
+    FieldPolynomial InvertPolynomial(const FieldPolynomial& value,
+                                     const FieldPolynomial& modulus,
+                                     int64_t p);
+
+    // Elements of a field with q elements are coded by sum c_i p^i.
+    // With a generator g, antilog[e] = g^e for e < 2(q - 1), so sums of
+    // two logs need no reduction, log inverts it, and the Zech logarithm
+    // zech[n] = log(1 + g^n) turns addition into lookups as well,
+    // it is q - 1 when 1 + g^n = 0
+    struct ExtensionTables {
+            std::vector<uint32_t> log;
+            std::vector<uint32_t> antilog;
+            std::vector<uint32_t> zech;
+    };
+
+    ExtensionTables BuildExtensionTables(int64_t p,
+                                         const FieldPolynomial& modulus);
+
+    // x^j mod modulus for j = k, ..., 2k - 2, k is the degree of modulus
+    std::vector<FieldPolynomial> BuildReductionTable(
+        int64_t p, const FieldPolynomial& modulus);
+
+    // fields up to this size are tabulated
+    constexpr inline int64_t kExtensionTableLimit = 1 << 16;
+}  // namespace Details
+
+// Finite field GF(P^K) = F_P[x] / f(x) for the irreducible polynomial f
+// given by GetDefiningPolynomial(), its root x is GetRoot(). Integers
+// embed as constants. Fields with at most 2^16 elements multiply, add and
+// invert by table lookups, larger ones keep K coefficients and reduce
+// products with the precomputed powers x^K, ..., x^{2K-2} mod f.
+template <int64_t P, size_t K>
+requires(IsPrime<P> && K >= 1) class GaloisField {
+    private:
+        static constexpr int64_t kOrder = Details::GetFieldOrder(P, K);
+        static constexpr bool kHasTables =
+            kOrder != 0 && kOrder <= Details::kExtensionTableLimit;
+        using Coefficients = std::array<Modulo<P>, K>;
+
+    public:
+        GaloisField(int64_t value = 0) {
+            Modulo<P> constant(value);
+            if constexpr (kHasTables) {
+                value_ = static_cast<uint32_t>(constant.GetValue());
+            } else {
+                value_[0] = constant;
+            }
+        }
+
+        // sum coefs[i] x^i, at most K coefficients
+        static GaloisField FromCoefficients(std::span<const int64_t> coefs) {
+            assert(coefs.size() <= K && "Too many coefficients");
+            GaloisField result;
+            for (size_t i = 0; i < coefs.size(); i++) {
+                result.SetCoefficient(i, Modulo<P>(coefs[i]));
+            }
+            return result;
+        }
+
+        static GaloisField GetRoot() {
+            if constexpr (K == 1) {
+                // f = x + c
+                return GaloisField(-GetDefiningPolynomial()[0]);
+            } else {
+                GaloisField result;
+                result.SetCoefficient(1, 1);
+                return result;
+            }
+        }
+
+        static const Details::FieldPolynomial& GetDefiningPolynomial() {
+            return GetTables().modulus;
+        }
+
+        static constexpr int64_t GetCharacteristic() { return P; }
+        static constexpr size_t GetDegree() { return K; }
+
+        // coefficient of x^i, in [0, P)
+        int64_t GetCoefficient(size_t i) const {
+            assert(i < K && "Out of bounds");
+            if constexpr (kHasTables) {
+                return value_ / kPowers[i] % P;
+            } else {
+                return value_[i].GetValue();
+            }
+        }
+
+        bool IsZero() const {
+            if constexpr (kHasTables) {
+                return value_ == 0;
+            } else {
+                for (const auto& coef : value_) {
+                    if (!coef.IsZero()) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        }
+
+        GaloisField Abs() const { return *this; }
+
+        GaloisField operator-() const {
+            GaloisField result;
+            if constexpr (kHasTables) {
+                if (P == 2 || value_ == 0) {
+                    return *this;
+                }
+                // -1 = g^{(q - 1) / 2}
+                const auto& tables = GetTables().ext;
+                result.value_ = tables.antilog[tables.log[value_] +
+                                               (kOrder - 1) / 2];
+            } else {
+                for (size_t i = 0; i < K; i++) {
+                    result.value_[i] = -value_[i];
+                }
+            }
+            return result;
+        }
+        GaloisField operator+() const { return *this; }
+
+        GaloisField& operator+=(const GaloisField& other) {
+            if constexpr (kHasTables) {
+                value_ = Add(value_, other.value_);
+            } else {
+                for (size_t i = 0; i < K; i++) {
+                    value_[i] += other.value_[i];
+                }
+            }
+            return *this;
+        }
+
+        GaloisField& operator-=(const GaloisField& other) {
+            if constexpr (kHasTables) {
+                value_ = Add(value_, (-other).value_);
+            } else {
+                for (size_t i = 0; i < K; i++) {
+                    value_[i] -= other.value_[i];
+                }
+            }
+            return *this;
+        }
+
+        GaloisField& operator*=(const GaloisField& other) {
+            if constexpr (kHasTables) {
+                if (value_ == 0 || other.value_ == 0) {
+                    value_ = 0;
+                    return *this;
+                }
+                const auto& tables = GetTables().ext;
+                value_ = tables.antilog[tables.log[value_] +
+                                        tables.log[other.value_]];
+            } else {
+                value_ = Multiply(value_, other.value_);
+            }
+            return *this;
+        }
+
+        GaloisField& operator/=(const GaloisField& other) {
+            assert(!other.IsZero() && "Can't divide by zero");
+            return *this *= other.GetInverse();
+        }
+
+        GaloisField operator+(const GaloisField& other) const {
+            GaloisField temp(*this);
+            temp += other;
+            return temp;
+        }
+
+        GaloisField operator-(const GaloisField& other) const {
+            GaloisField temp(*this);
+            temp -= other;
+            return temp;
+        }
+
+        GaloisField operator*(const GaloisField& other) const {
+            GaloisField temp(*this);
+            temp *= other;
+            return temp;
+        }
+
+        GaloisField operator/(const GaloisField& other) const {
+            GaloisField temp(*this);
+            temp /= other;
+            return temp;
+        }
+
+        bool operator==(const GaloisField& other) const {
+            return value_ == other.value_;
+        }
+
+        bool operator!=(const GaloisField& other) const {
+            return !(*this == other);
+        }
+
+        // by coefficients from x^{K-1} down, an arbitrary total order
+        bool operator<(const GaloisField& other) const {
+            if constexpr (kHasTables) {
+                return value_ < other.value_;
+            } else {
+                for (size_t i = K; i-- > 0;) {
+                    if (value_[i] != other.value_[i]) {
+                        return value_[i] < other.value_[i];
+                    }
+                }
+                return false;
+            }
+        }
+
+        bool operator<=(const GaloisField& other) const {
+            return !(other < *this);
+        }
+
+        bool operator>(const GaloisField& other) const { return other < *this; }
+
+        bool operator>=(const GaloisField& other) const {
+            return other <= *this;
+        }
+
+    private:
+        struct Tables {
+                Details::FieldPolynomial modulus;
+                Details::ExtensionTables ext;
+                std::vector<Coefficients> reduction;
+        };
+
+        static const Tables& GetTables() {
+            static const Tables tables = [] {
+                Tables result;
+                result.modulus = Details::FindIrreduciblePolynomial(P, K);
+                if constexpr (kHasTables) {
+                    result.ext =
+                        Details::BuildExtensionTables(P, result.modulus);
+                } else {
+                    for (const auto& power :
+                         Details::BuildReductionTable(P, result.modulus)) {
+                        result.reduction.push_back(ToCoefficients(power));
+                    }
+                }
+                return result;
+            }();
+            return tables;
+        }
+
+        static constexpr auto kPowers = [] {
+            std::array<int64_t, K> powers{};
+            if constexpr (kHasTables) {
+                powers[0] = 1;
+                for (size_t i = 1; i < K; i++) {
+                    powers[i] = powers[i - 1] * P;
+                }
+            }
+            return powers;
+        }();
+
+        static Coefficients ToCoefficients(
+            const Details::FieldPolynomial& poly) {
+            Coefficients result;
+            for (size_t i = 0; i < poly.size(); i++) {
+                result[i] = poly[i];
+            }
+            return result;
+        }
+
+        void SetCoefficient(size_t i, Modulo<P> coef) {
+            if constexpr (kHasTables) {
+                value_ += static_cast<uint32_t>(
+                    (coef.GetValue() - GetCoefficient(i)) * kPowers[i]);
+            } else {
+                value_[i] = coef;
+            }
+        }
+
+        // lhs + rhs = lhs (1 + rhs / lhs) = g^{log lhs + zech[log rhs - log lhs]}
+        static uint32_t Add(uint32_t lhs, uint32_t rhs) {
+            if constexpr (P == 2) {
+                return lhs ^ rhs;
+            } else {
+                if (lhs == 0 || rhs == 0) {
+                    return lhs | rhs;
+                }
+                const auto& tables = GetTables().ext;
+                uint32_t lhs_log = tables.log[lhs];
+                uint32_t difference = tables.log[rhs] + (kOrder - 1) - lhs_log;
+                difference -= difference >= kOrder - 1 ? kOrder - 1 : 0;
+                uint32_t zech = tables.zech[difference];
+                if (zech == kOrder - 1) {
+                    return 0;
+                }
+                return tables.antilog[lhs_log + zech];
+            }
+        }
+
+        // schoolbook product, the coefficients of x^K.. are folded back
+        // through the reduction table
+        static Coefficients Multiply(const Coefficients& lhs,
+                                     const Coefficients& rhs) {
+            const auto& reduction = GetTables().reduction;
+            std::array<Modulo<P>, (K > 1 ? K - 1 : 1)> high{};
+            for (size_t j = K; j + 1 < 2 * K; j++) {
+                for (size_t i = j - K + 1; i < K; i++) {
+                    high[j - K] += lhs[i] * rhs[j - i];
+                }
+            }
+
+            Coefficients result;
+            for (size_t i = 0; i < K; i++) {
+                Modulo<P> sum;
+                for (size_t t = 0; t <= i; t++) {
+                    sum += lhs[t] * rhs[i - t];
+                }
+                for (size_t j = 0; j + 1 < K; j++) {
+                    sum += high[j] * reduction[j][i];
+                }
+                result[i] = sum;
+            }
+            return result;
+        }
+
+        GaloisField GetInverse() const {
+            assert(!IsZero() && "No inverse element for zero");
+            GaloisField result;
+            if constexpr (kHasTables) {
+                const auto& tables = GetTables().ext;
+                result.value_ =
+                    tables.antilog[(kOrder - 1) - tables.log[value_]];
+            } else {
+                Details::FieldPolynomial poly(K);
+                for (size_t i = 0; i < K; i++) {
+                    poly[i] = value_[i].GetValue();
+                }
+                result.value_ = ToCoefficients(Details::InvertPolynomial(
+                    poly, GetDefiningPolynomial(), P));
+            }
+            return result;
+        }
+
+        // the code sum c_i P^i for tabulated fields, the coefficients
+        // c_0, ..., c_{K-1} otherwise
+        std::conditional_t<kHasTables, uint32_t, Coefficients> value_{};
+};
+
+}  // namespace Groebner
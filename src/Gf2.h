@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cassert>
+#include <cinttypes>
+
+namespace Groebner {
+
+// The field of two elements: addition is XOR and multiplication is AND,
+// so no reduction is ever needed. Polynomials over it can also be packed
+// into bits, see BitMatrix and Gf2System.h.
+class Gf2 {
+    public:
+        using ValueType = uint8_t;
+
+        // parity of value, so -1 and 1 are the same element
+        Gf2(int64_t value = 0) : value_(static_cast<ValueType>(value & 1)) {}
+
+        static constexpr int64_t GetModulus() { return 2; }
+
+        ValueType GetValue() const { return value_; }
+
+        bool IsZero() const { return value_ == 0; }
+
+        Gf2 Abs() const { return *this; }
+
+        // x = -x in characteristic two
+        Gf2 operator-() const { return *this; }
+        Gf2 operator+() const { return *this; }
+
+        Gf2& operator+=(const Gf2& other) {
+            value_ ^= other.value_;
+            return *this;
+        }
+
+        Gf2& operator-=(const Gf2& other) {
+            value_ ^= other.value_;
+            return *this;
+        }
+
+        Gf2& operator*=(const Gf2& other) {
+            value_ &= other.value_;
+            return *this;
+        }
+
+        // 1 is the only divisor and its own inverse
+        Gf2& operator/=([[maybe_unused]] const Gf2& other) {
+            assert(other.value_ != 0 && "Can't divide by zero");
+            return *this;
+        }
+
+        Gf2 operator+(const Gf2& other) const {
+            Gf2 temp(*this);
+            temp += other;
+            return temp;
+        }
+
+        Gf2 operator-(const Gf2& other) const {
+            Gf2 temp(*this);
+            temp -= other;
+            return temp;
+        }
+
+        Gf2 operator*(const Gf2& other) const {
+            Gf2 temp(*this);
+            temp *= other;
+            return temp;
+        }
+
+        Gf2 operator/(const Gf2& other) const {
+            Gf2 temp(*this);
+            temp /= other;
+            return temp;
+        }
+
+        bool operator==(const Gf2& other) const {
+            return value_ == other.value_;
+        }
+
+        bool operator!=(const Gf2& other) const { return !(*this == other); }
+
+        bool operator<(const Gf2& other) const {
+            return value_ < other.value_;
+        }
+
+        bool operator<=(const Gf2& other) const {
+            return value_ <= other.value_;
+        }
+
+        bool operator>(const Gf2& other) const { return other < *this; }
+
+        bool operator>=(const Gf2& other) const { return other <= *this; }
+
+    private:
+        // 0 or 1
+        ValueType value_;
+};
+
+}  // namespace Groebner
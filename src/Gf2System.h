@@ -0,0 +1,104 @@
+#pragma once
+
+#include "BitMatrix.h"
+#include "Gf2.h"
+#include "PolySystem.h"
+
+#include <map>
+#include <vector>
+
+namespace Groebner {
+
+// Boolean polynomials: every variable is 0 or 1, so x^2 = x holds and
+// any positive exponent can be replaced by one.
+template <IsComparator Comparator>
+Polynomial<Gf2, Comparator> ApplyFieldEquations(
+    const Polynomial<Gf2, Comparator>& poly) {
+    std::vector<Term<Gf2>> terms;
+    terms.reserve(poly.GetSize());
+    for (const auto& [degree, coef] : poly) {
+        Monomial reduced(degree.GetSize());
+        for (size_t i = 0; i < degree.GetSize(); i++) {
+            reduced.SetDegree(i, degree.GetDegree(i) > 0 ? 1 : 0);
+        }
+        terms.push_back({coef, std::move(reduced)});
+    }
+    // equal monomials are summed, pairs of them cancel
+    return Polynomial<Gf2, Comparator>(std::move(terms), poly.get_allocator());
+}
+
+template <IsComparator Comparator>
+PolySystem<Gf2, Comparator> ApplyFieldEquations(
+    const PolySystem<Gf2, Comparator>& system) {
+    PolySystem<Gf2, Comparator> result(system.GetResource());
+    for (size_t i = 0; i < system.GetSize(); i++) {
+        result.Add(ApplyFieldEquations(system[i]));
+    }
+    return result;
+}
+
+// appends x_i^2 + x_i for the first vars_count variables, a Groebner basis
+// of the result only has the solutions with every x_i in {0, 1}
+template <IsComparator Comparator>
+void AddFieldEquations(PolySystem<Gf2, Comparator>& system,
+                       size_t vars_count) {
+    for (size_t i = 0; i < vars_count; i++) {
+        Monomial square(i + 1);
+        square.SetDegree(i, 2);
+        Monomial variable(i + 1);
+        variable.SetDegree(i, 1);
+        system.Add(Polynomial<Gf2, Comparator>(
+            {{1, std::move(square)}, {1, std::move(variable)}},
+            system.GetResource()));
+    }
+}
+
+// Linear algebra step over the monomials of the system: every polynomial
+// is a bit row, columns go from the greatest monomial down, and the
+// reduced row echelon form is the interreduced linear span. The result
+// has distinct leaders, none of them occurring in another polynomial.
+template <IsComparator Comparator>
+PolySystem<Gf2, Comparator> ReduceLinear(
+    const PolySystem<Gf2, Comparator>& system) {
+    struct Compare {
+            bool operator()(const Monomial& lhs, const Monomial& rhs) const {
+                return Comparator::IsGreater(lhs, rhs);
+            }
+    };
+    std::map<Monomial, size_t, Compare> columns;
+    for (size_t i = 0; i < system.GetSize(); i++) {
+        for (const auto& [degree, coef] : system[i]) {
+            columns.emplace(degree, 0);
+        }
+    }
+    std::vector<const Monomial*> monomials;
+    monomials.reserve(columns.size());
+    for (auto& [degree, col] : columns) {
+        col = monomials.size();
+        monomials.push_back(&degree);
+    }
+
+    BitMatrix matrix(system.GetSize(), columns.size());
+    for (size_t i = 0; i < system.GetSize(); i++) {
+        for (const auto& [degree, coef] : system[i]) {
+            matrix.Set(i, columns.find(degree)->second, true);
+        }
+    }
+    size_t rank = matrix.Eliminate();
+
+    PolySystem<Gf2, Comparator> result(system.GetResource());
+    for (size_t row = 0; row < rank; row++) {
+        std::vector<Term<Gf2>> terms;
+        for (size_t col = matrix.FindPivot(row); col < columns.size();
+             col++) {
+            if (matrix.Get(row, col)) {
+                terms.push_back({1, *monomials[col]});
+            }
+        }
+        result.Add(Polynomial<Gf2, Comparator>(std::move(terms),
+                                                system.GetResource()));
+    }
+    return result;
+}
+
+}  // namespace Groebner
@@ -1,12 +1,23 @@
 #pragma once
 
+#include "FractionFree.h"
+#include "Inversion.h"
 #include "PolySystem.h"
 #include "Printer.h"
 
+#include <memory_resource>
+#include <span>
+#include <vector>
+
 namespace Groebner {
 
 enum class AutoReduction { Enabled, Disabled };
 
+// FractionFree keeps Rational and BigRational polynomials with coprime
+// integer coefficients and reduces them by cross-multiplying, other fields
+// always use Fractions
+enum class CoefficientMode { Fractions, FractionFree };
+
 template <IsSupportedField Field, IsComparator Comparator>
 struct SPolyInfo {
         Polynomial<Field, Comparator> s_poly;
@@ -17,10 +28,27 @@ class GroebnerAlgorithm {
     public:
         GroebnerAlgorithm() = delete;
 
+        // All intermediate polynomials live in an arena owned by this call
+        // and drawn from upstream; it is released at once on return,
+        // the result is copied back into poly_system's own resource.
+        template <IsSupportedField Field, IsComparator Comparator>
+        static void BuildGBInplace(
+            PolySystem<Field, Comparator>& poly_system,
+            AutoReduction reduction = AutoReduction::Disabled,
+            std::pmr::memory_resource* upstream =
+                std::pmr::get_default_resource()) {
+            BuildGBInplace(poly_system, reduction, CoefficientMode::Fractions,
+                           upstream);
+        }
+
+        // in FractionFree mode the basis is made of primitive integer
+        // polynomials, a reduced basis is still monic
         template <IsSupportedField Field, IsComparator Comparator>
         static void BuildGBInplace(
             PolySystem<Field, Comparator>& poly_system,
-            AutoReduction reduction = AutoReduction::Disabled) {
+            AutoReduction reduction, CoefficientMode mode,
+            std::pmr::memory_resource* upstream =
+                std::pmr::get_default_resource()) {
             poly_system.Reduce();
             if (poly_system.IsEmpty()) {
                 Printer::Instance().PrintMessage(
@@ -35,29 +63,56 @@ class GroebnerAlgorithm {
                 .PrintPolySystem(poly_system, Printer::CONDITIONS,
                                  Printer::DOUBLE_NEW_LINE);
 
-            for (size_t i = 0; i < poly_system.GetSize(); ++i) {
-                if (poly_system[i].IsZero()) {
+            std::pmr::monotonic_buffer_resource arena(upstream);
+            // freed map nodes are reused instead of growing the arena
+            std::pmr::unsynchronized_pool_resource pool(&arena);
+            PolySystem<Field, Comparator> basis(poly_system, &pool);
+            MakePrimitive(basis, mode);
+            // kept in step with the basis, pseudo-reduction needs none
+            std::vector<Field> inverses;
+            if (!IsFractionFree<Field>(mode)) {
+                inverses = GetLeaderInverses(basis);
+            }
+
+            for (size_t i = 0; i < basis.GetSize(); ++i) {
+                if (basis[i].IsZero()) {
                     continue;
                 }
-                AddRemindersToPolyAtPos(i, poly_system);
+                AddRemindersToPolyAtPos(i, basis, mode, inverses);
             }
 
             Printer::Instance()
                 .PrintMessage("Basis:", Printer::CONDITIONS, Printer::NEW_LINE)
-                .PrintPolySystem(poly_system, Printer::CONDITIONS,
+                .PrintPolySystem(basis, Printer::CONDITIONS,
                                  Printer::DOUBLE_NEW_LINE);
 
             if (reduction == AutoReduction::Enabled) {
-                ReduceBasisInplace(poly_system);
+                ReduceBasisInplace(basis, mode);
             }
+
+            poly_system = PolySystem<Field, Comparator>(
+                basis, poly_system.get_allocator());
         }
 
         template <IsSupportedField Field, IsComparator Comparator>
         static PolySystem<Field, Comparator> BuildGB(
             const PolySystem<Field, Comparator>& poly_system,
-            AutoReduction reduction = AutoReduction::Disabled) {
+            AutoReduction reduction = AutoReduction::Disabled,
+            std::pmr::memory_resource* upstream =
+                std::pmr::get_default_resource()) {
             PolySystem<Field, Comparator> result(poly_system);
-            BuildGBInplace(result, reduction);
+            BuildGBInplace(result, reduction, upstream);
+            return result;
+        }
+
+        template <IsSupportedField Field, IsComparator Comparator>
+        static PolySystem<Field, Comparator> BuildGB(
+            const PolySystem<Field, Comparator>& poly_system,
+            AutoReduction reduction, CoefficientMode mode,
+            std::pmr::memory_resource* upstream =
+                std::pmr::get_default_resource()) {
+            PolySystem<Field, Comparator> result(poly_system);
+            BuildGBInplace(result, reduction, mode, upstream);
             return result;
         }
 
@@ -72,8 +127,12 @@ class GroebnerAlgorithm {
             return common_degree;
         }
 
+        // any coefficients are accepted in either mode, FractionFree mode
+        // works on primitive copies of the kept polynomials
         template <IsSupportedField Field, IsComparator Comparator>
-        static void ReduceBasisInplace(PolySystem<Field, Comparator>& basis) {
+        static void ReduceBasisInplace(
+            PolySystem<Field, Comparator>& basis,
+            CoefficientMode mode = CoefficientMode::Fractions) {
             // TODO add poly_system.reduce()
 
             Printer::Instance()
@@ -82,7 +141,7 @@ class GroebnerAlgorithm {
                 .PrintPolySystem(basis, Printer::CONDITIONS,
                                  Printer::DOUBLE_NEW_LINE);
 
-            PolySystem<Field, Comparator> temp;
+            PolySystem<Field, Comparator> temp(basis.get_allocator());
             for (size_t i = 0; i < basis.GetSize(); i++) {
                 if (!CanEraseFromBasisAtPos(basis, i)) {
                     Printer::Instance().PrintPolyStays(basis[i], i,
@@ -100,11 +159,15 @@ class GroebnerAlgorithm {
                               Printer::NEW_LINE)
                 .PrintPolySystem(temp, Printer::DETAILS,
                                  Printer::DOUBLE_NEW_LINE);
+            MakePrimitive(temp, mode);
 
-            basis = PolySystem<Field, Comparator>();
+            basis = PolySystem<Field, Comparator>(basis.get_allocator());
             for (size_t i = 0; i < temp.GetSize(); i++) {
                 const Polynomial<Field, Comparator> cur = temp.SwapAndPop(i);
-                auto reduced = ReducePolynomial(cur, temp);
+                std::vector<Field> inverses(temp.GetSize());
+                auto reduced = ReduceByBasis(
+                    Polynomial<Field, Comparator>(cur, cur.get_allocator()),
+                    temp, mode, std::span<Field>(inverses));
                 Printer::Instance().PrintPolyReplaced(cur, reduced, i,
                                                       Printer::DETAILS,
                                                       Printer::DOUBLE_NEW_LINE);
@@ -112,8 +175,9 @@ class GroebnerAlgorithm {
                 temp.AddAndSwap(i, cur);
             }
 
+            std::vector<Field> inverses = GetLeaderInverses(basis);
             for (size_t i = 0; i < basis.GetSize(); i++) {
-                basis[i].ReduceByLeaderCoef();
+                basis[i].ReduceByLeaderCoef(inverses[i]);
             }
 
             Printer::Instance()
@@ -135,55 +199,55 @@ class GroebnerAlgorithm {
         static SPolyInfo<Field, Comparator> SPolynomial(
             const Polynomial<Field, Comparator>& lhs,
             const Polynomial<Field, Comparator>& rhs) {
-            const auto& [lhs_coef, lhs_degree] = lhs.GetLeader();
-            const auto& [rhs_coef, rhs_degree] = rhs.GetLeader();
+            const auto& lhs_coef = lhs.GetLeaderCoef();
+            const auto& lhs_degree = lhs.GetLeaderDegree();
+            const auto& rhs_coef = rhs.GetLeaderCoef();
+            const auto& rhs_degree = rhs.GetLeaderDegree();
 
             auto common_degree =
                 FindMinimalCommonDegree(lhs_degree, rhs_degree);
-            Term<Field> lcm{lhs_coef * rhs_coef, common_degree};
+            // lcm / leader for each side
+            Term<Field> lhs_factor{rhs_coef, common_degree - lhs_degree};
+            Term<Field> rhs_factor{lhs_coef, common_degree - rhs_degree};
 
-            auto spoly =
-                lhs * (lcm / lhs.GetLeader()) - rhs * (lcm / rhs.GetLeader());
+            auto spoly = lhs * lhs_factor;
+            spoly.SubMulTerm(rhs, rhs_factor);
 
             PrinterBuffer<Field, Comparator>::Instance().SetBuffer(2);
             PrinterBuffer<Field, Comparator>::Instance()[0] +=
-                (lcm / lhs.GetLeader());
+                std::move(lhs_factor);
             PrinterBuffer<Field, Comparator>::Instance()[1] +=
-                (lcm / rhs.GetLeader());
+                std::move(rhs_factor);
 
             return SPolyInfo(std::move(spoly), std::move(common_degree));
         }
 
+        // in FractionFree mode the reducers are primitive copies of
+        // poly_system, the remainder is primitive and only known up to
+        // a rational factor
         template <IsSupportedField Field, IsComparator Comparator>
         static Polynomial<Field, Comparator> ReducePolynomial(
             Polynomial<Field, Comparator>&& poly,
-            const PolySystem<Field, Comparator>& poly_system) {
-
-            Printer::Instance().PrintReducePolynomial(
-                poly, poly_system, Printer::DETAILS, Printer::NEW_LINE);
-            PrinterBuffer<Field, Comparator>::Instance().SetBuffer(
-                poly_system.GetSize());
-
-            Polynomial<Field, Comparator> rem;
-            auto copy = poly;
-            while (!poly.IsZero()) {
-                if (!DividePoly(poly, poly_system)) {
-                    rem += poly.GetLeader();
-                    poly -= poly.GetLeader();
-                }
+            const PolySystem<Field, Comparator>& poly_system,
+            CoefficientMode mode = CoefficientMode::Fractions) {
+            if (IsFractionFree<Field>(mode)) {
+                PolySystem<Field, Comparator> primitive(poly_system);
+                MakePrimitive(primitive, mode);
+                return ReduceByBasis(std::move(poly), primitive, mode, {});
             }
-
-            Printer::Instance().PrintRemainder(
-                copy, poly_system, rem, Printer::DETAILS, Printer::NEW_LINE);
-            return rem;
+            // inverted only when a reducer is first used
+            std::vector<Field> inverses(poly_system.GetSize());
+            return ReduceByLeaders(std::move(poly), poly_system,
+                                   std::span<Field>(inverses));
         }
 
         template <IsSupportedField Field, IsComparator Comparator>
         static Polynomial<Field, Comparator> ReducePolynomial(
             const Polynomial<Field, Comparator>& poly,
-            const PolySystem<Field, Comparator>& poly_system) {
-            Polynomial<Field, Comparator> temp = poly;
-            return ReducePolynomial(std::move(temp), poly_system);
+            const PolySystem<Field, Comparator>& poly_system,
+            CoefficientMode mode = CoefficientMode::Fractions) {
+            Polynomial<Field, Comparator> temp(poly, poly.get_allocator());
+            return ReducePolynomial(std::move(temp), poly_system, mode);
         }
 
         template <IsSupportedField Field, IsComparator Comparator>
@@ -251,17 +315,21 @@ class GroebnerAlgorithm {
         }
 
     private:
+        // inverses[i] is 1 / poly_system[i].GetLeaderCoef(), it grows
+        // with the system unless mode is FractionFree
         template <IsSupportedField Field, IsComparator Comparator>
         static void AddRemindersToPolyAtPos(
-            size_t pos, PolySystem<Field, Comparator>& poly_system) {
-            auto leader = poly_system[pos].GetLeader();
+            size_t pos, PolySystem<Field, Comparator>& poly_system,
+            CoefficientMode mode, std::vector<Field>& inverses) {
+            // copied, Add below may move the polynomials
+            Monomial leader_degree = poly_system[pos].GetLeaderDegree();
             for (size_t j = 0; j < pos; j++) {
-                auto other_leader = poly_system[j].GetLeader();
                 Printer::Instance().PrintBuildingSPoly(
                     pos, j, Printer::CONDITIONS, Printer::NEW_LINE);
                 SPolyInfo info = SPolynomial(poly_system[pos], poly_system[j]);
 
-                if (leader.degree + other_leader.degree == info.common_degree) {
+                if (leader_degree + poly_system[j].GetLeaderDegree() ==
+                    info.common_degree) {
                     Printer::Instance().SkipSPolynomial(
                         poly_system, pos, j, Printer::CONDITIONS,
                         Printer::DOUBLE_NEW_LINE);
@@ -272,11 +340,16 @@ class GroebnerAlgorithm {
                                                      pos, j, Printer::DETAILS,
                                                      Printer::NEW_LINE);
 
-                auto remainder =
-                    ReducePolynomial(std::move(info.s_poly), poly_system);
+                auto remainder = ReduceByBasis(std::move(info.s_poly),
+                                               poly_system, mode,
+                                               std::span<Field>(inverses));
 
                 if (!remainder.IsZero()) {
-                    remainder.ReduceByLeaderCoef();
+                    // pseudo-remainders are primitive already
+                    if (!IsFractionFree<Field>(mode)) {
+                        remainder.ReduceByLeaderCoef();
+                        inverses.push_back(Field(1));
+                    }
                     Printer::Instance().PrintAddToSystem(
                         remainder, poly_system.GetSize(), Printer::CONDITIONS,
                         Printer::DOUBLE_NEW_LINE);
@@ -289,36 +362,199 @@ class GroebnerAlgorithm {
             }
         }
 
+        // one inversion for all leader coefficients, zero ones stay zero
+        template <IsSupportedField Field, IsComparator Comparator>
+        static std::vector<Field> GetLeaderInverses(
+            const PolySystem<Field, Comparator>& poly_system) {
+            std::vector<Field> inverses;
+            inverses.reserve(poly_system.GetSize());
+            for (size_t i = 0; i < poly_system.GetSize(); ++i) {
+                if (!poly_system[i].IsZero()) {
+                    inverses.push_back(poly_system[i].GetLeaderCoef());
+                }
+            }
+            Details::InvertBatch(std::span(inverses));
+
+            std::vector<Field> result(poly_system.GetSize());
+            auto it = inverses.begin();
+            for (size_t i = 0; i < poly_system.GetSize(); ++i) {
+                if (!poly_system[i].IsZero()) {
+                    result[i] = std::move(*it++);
+                }
+            }
+            return result;
+        }
+
+        template <IsSupportedField Field>
+        static bool IsFractionFree(CoefficientMode mode) {
+            return Details::kIsFractionFieldV<Field> &&
+                   mode == CoefficientMode::FractionFree;
+        }
+
+        // in FractionFree mode every polynomial becomes primitive
+        template <IsSupportedField Field, IsComparator Comparator>
+        static void MakePrimitive(PolySystem<Field, Comparator>& poly_system,
+                                  CoefficientMode mode) {
+            if constexpr (Details::kIsFractionFieldV<Field>) {
+                for (size_t i = 0;
+                     mode == CoefficientMode::FractionFree &&
+                     i < poly_system.GetSize();
+                     ++i) {
+                    Details::MakePrimitive(poly_system[i]);
+                }
+            }
+        }
+
+        // ReducePolynomial for a system that is already primitive
+        // in FractionFree mode, so no copy is made; leader_inverses as in
+        // DividePoly, unused in FractionFree mode
+        template <IsSupportedField Field, IsComparator Comparator>
+        static Polynomial<Field, Comparator> ReduceByBasis(
+            Polynomial<Field, Comparator>&& poly,
+            const PolySystem<Field, Comparator>& basis, CoefficientMode mode,
+            std::span<Field> leader_inverses) {
+            if constexpr (Details::kIsFractionFieldV<Field>) {
+                if (mode == CoefficientMode::FractionFree) {
+                    return PseudoReducePolynomial(std::move(poly), basis);
+                }
+            }
+            return ReduceByLeaders(std::move(poly), basis, leader_inverses);
+        }
+
+        // every quotient term is a product by a leader inverse,
+        // not a division
+        template <IsSupportedField Field, IsComparator Comparator>
+        static Polynomial<Field, Comparator> ReduceByLeaders(
+            Polynomial<Field, Comparator>&& poly,
+            const PolySystem<Field, Comparator>& poly_system,
+            std::span<Field> leader_inverses) {
+            Printer::Instance().PrintReducePolynomial(
+                poly, poly_system, Printer::DETAILS, Printer::NEW_LINE);
+            PrinterBuffer<Field, Comparator>::Instance().SetBuffer(
+                poly_system.GetSize());
+
+            Polynomial<Field, Comparator> rem(poly.get_allocator());
+            Polynomial<Field, Comparator> copy(poly, poly.get_allocator());
+            while (!poly.IsZero()) {
+                if (!DividePoly(poly, poly_system, leader_inverses)) {
+                    poly.MoveLeaderTo(rem);
+                }
+            }
+
+            Printer::Instance().PrintRemainder(
+                copy, poly_system, rem, Printer::DETAILS, Printer::NEW_LINE);
+            return rem;
+        }
+
+        // index of the first polynomial whose leader divides the leader
+        // of poly, poly_system.GetSize() if there is none
+        template <IsSupportedField Field, IsComparator Comparator>
+        static size_t FindLeaderDivisor(
+            const Polynomial<Field, Comparator>& poly,
+            const PolySystem<Field, Comparator>& poly_system) {
+            for (size_t i = 0; i < poly_system.GetSize(); ++i) {
+                if (poly.IsLeaderDivisibleBy(poly_system[i])) {
+                    return i;
+                }
+            }
+            return poly_system.GetSize();
+        }
+
+        // leader_inverses[i] is 1 / poly_system[i].GetLeaderCoef(),
+        // or zero until that reducer is first used
         template <IsSupportedField Field, IsComparator Comparator>
         static bool DividePoly(
             Polynomial<Field, Comparator>& poly,
+            const PolySystem<Field, Comparator>& poly_system,
+            std::span<Field> leader_inverses) {
+            assert(leader_inverses.size() == poly_system.GetSize());
+            size_t i = FindLeaderDivisor(poly, poly_system);
+            if (i == poly_system.GetSize()) {
+                return false;
+            }
+
+            if (leader_inverses[i].IsZero()) {
+                leader_inverses[i] =
+                    Field(1) / poly_system[i].GetLeaderCoef();
+            }
+            Term<Field> temp{
+                poly.GetLeaderCoef() * leader_inverses[i],
+                poly.GetLeaderDegree() - poly_system[i].GetLeaderDegree()};
+            poly.SubMulTerm(poly_system[i], temp);
+            PrinterBuffer<Field, Comparator>::Instance()[i] += std::move(temp);
+            return true;
+        }
+
+        // content is divided out after this many scalings of the remainder
+        static constexpr size_t kContentPeriod = 8;
+
+        // Pseudo-reduction: for leaders a of poly and b of the reducer f
+        // with g = gcd(a, b), poly becomes (b / g) poly - (a / g) t f, so the
+        // coefficients stay integers and nothing is divided. The remainder
+        // is scaled along with poly, both lose their common content every
+        // kContentPeriod scalings. Quotients are not recorded, since
+        // c poly = sum q_i f_i + r holds only for some integer c.
+        // The reducers must be primitive, see MakePrimitive above.
+        template <IsSupportedField Field, IsComparator Comparator>
+        requires Details::kIsFractionFieldV<Field>
+        static Polynomial<Field, Comparator> PseudoReducePolynomial(
+            Polynomial<Field, Comparator>&& poly,
             const PolySystem<Field, Comparator>& poly_system) {
-            const auto& [coef, degree] = poly.GetLeader();
-            for (size_t i = 0; i < poly_system.GetSize(); ++i) {
-                const auto& [other_coef, other_degree] =
-                    poly_system[i].GetLeader();
-                if (degree.IsDivisible(other_degree)) {
-                    assert(!poly_system[i].GetLeader().coef.IsZero() &&
-                           "Can't divide by zero");
-                    auto temp = poly.GetLeader() / poly_system[i].GetLeader();
-                    PrinterBuffer<Field, Comparator>::Instance()[i] += temp;
-                    poly -= poly_system[i] * temp;
-                    return true;
+            Printer::Instance().PrintReducePolynomial(
+                poly, poly_system, Printer::DETAILS, Printer::NEW_LINE);
+
+            Details::MakePrimitive(poly);
+            Polynomial<Field, Comparator> rem(poly.get_allocator());
+            size_t scalings = 0;
+            while (!poly.IsZero()) {
+                size_t i = FindLeaderDivisor(poly, poly_system);
+                if (i == poly_system.GetSize()) {
+                    poly.MoveLeaderTo(rem);
+                    continue;
+                }
+
+                const auto& reducer = poly_system[i];
+                assert(reducer.GetLeaderCoef().GetDenominator() == 1 &&
+                       "Coefficients must be integers");
+                auto lhs = poly.GetLeaderCoef().GetNumerator();
+                auto rhs = reducer.GetLeaderCoef().GetNumerator();
+                auto gcd = Details::GetGcd(lhs, rhs);
+                Field scale(rhs / gcd);
+                Term<Field> term{Field(lhs / gcd), poly.GetLeaderDegree() -
+                                                       reducer.GetLeaderDegree()};
+                if (scale != Field(1)) {
+                    poly.ScaleCoefs(scale);
+                    rem.ScaleCoefs(scale);
+                    ++scalings;
+                }
+                poly.SubMulTerm(reducer, term);
+
+                if (scalings == kContentPeriod) {
+                    scalings = 0;
+                    auto content = Details::GetGcd(Details::GetContent(poly),
+                                                   Details::GetContent(rem));
+                    Details::RemoveContent(poly, content);
+                    Details::RemoveContent(rem, content);
                 }
             }
+            Details::MakePrimitive(rem);
 
-            return false;
+            Printer::Instance()
+                .PrintMessage("Pseudo-remainder: ", Printer::DETAILS,
+                              Printer::NO_NEW_LINE)
+                .PrintPolynomial(rem, Printer::DETAILS, Printer::NEW_LINE);
+            return rem;
         }
 
         template <IsSupportedField Field, IsComparator Comparator>
         static bool CanEraseFromBasisAtPos(
             const PolySystem<Field, Comparator>& basis, size_t pos) {
-            const auto& [coef, degree] = basis[pos].GetLeader();
+            const auto& degree = basis[pos].GetLeaderDegree();
             for (size_t j = 0; j < basis.GetSize(); j++) {
-                const auto& [other_coef, other_degree] = basis[j].GetLeader();
-                if ((pos < j && degree.IsDivisible(other_degree)) ||
-                    (pos > j && degree != other_degree &&
-                     degree.IsDivisible(other_degree))) {
+                if (j == pos || !basis[pos].IsLeaderDivisibleBy(basis[j])) {
+                    continue;
+                }
+                if (pos < j || degree != basis[j].GetLeaderDegree()) {
                     Printer::Instance().PrintPolyInBasisReduced(
                         basis, pos, j, Printer::DETAILS, Printer::NEW_LINE);
                     return true;
@@ -0,0 +1,449 @@
+#include "Integer.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <limits>
+#include <numeric>
+
+namespace Groebner {
+namespace {
+    using Magnitude = std::vector<Integer::LimbType>;
+    constexpr int kLimbBits = 32;
+    constexpr uint64_t kLimbMask = 0xFFFFFFFFULL;
+
+    void Trim(Magnitude& value) {
+        while (!value.empty() && value.back() == 0) {
+            value.pop_back();
+        }
+    }
+
+    Magnitude FromUnsigned(uint64_t value) {
+        Magnitude result = {static_cast<Integer::LimbType>(value),
+                            static_cast<Integer::LimbType>(value >> kLimbBits)};
+        Trim(result);
+        return result;
+    }
+
+    int CompareMagnitudes(const Magnitude& lhs, const Magnitude& rhs) {
+        if (lhs.size() != rhs.size()) {
+            return lhs.size() < rhs.size() ? -1 : 1;
+        }
+        for (size_t i = lhs.size(); i-- > 0;) {
+            if (lhs[i] != rhs[i]) {
+                return lhs[i] < rhs[i] ? -1 : 1;
+            }
+        }
+        return 0;
+    }
+
+    Magnitude AddMagnitudes(const Magnitude& lhs, const Magnitude& rhs) {
+        const Magnitude& longer = lhs.size() < rhs.size() ? rhs : lhs;
+        const Magnitude& shorter = lhs.size() < rhs.size() ? lhs : rhs;
+        Magnitude result(longer.size() + 1);
+        uint64_t carry = 0;
+        for (size_t i = 0; i < longer.size(); i++) {
+            uint64_t sum = carry + longer[i] +
+                           (i < shorter.size() ? shorter[i] : 0);
+            result[i] = static_cast<Integer::LimbType>(sum);
+            carry = sum >> kLimbBits;
+        }
+        result.back() = static_cast<Integer::LimbType>(carry);
+        Trim(result);
+        return result;
+    }
+
+    // lhs >= rhs
+    Magnitude SubtractMagnitudes(const Magnitude& lhs, const Magnitude& rhs) {
+        Magnitude result(lhs.size());
+        int64_t borrow = 0;
+        for (size_t i = 0; i < lhs.size(); i++) {
+            int64_t diff = static_cast<int64_t>(lhs[i]) - borrow -
+                           (i < rhs.size() ? rhs[i] : 0);
+            borrow = diff < 0;
+            result[i] = static_cast<Integer::LimbType>(diff);
+        }
+        assert(borrow == 0 && "Subtrahend is greater than minuend");
+        Trim(result);
+        return result;
+    }
+
+    Magnitude MultiplyMagnitudes(const Magnitude& lhs, const Magnitude& rhs) {
+        if (lhs.empty() || rhs.empty()) {
+            return {};
+        }
+        Magnitude result(lhs.size() + rhs.size());
+        for (size_t i = 0; i < lhs.size(); i++) {
+            uint64_t carry = 0;
+            for (size_t j = 0; j < rhs.size(); j++) {
+                uint64_t product = static_cast<uint64_t>(lhs[i]) * rhs[j] +
+                                   result[i + j] + carry;
+                result[i + j] = static_cast<Integer::LimbType>(product);
+                carry = product >> kLimbBits;
+            }
+            result[i + rhs.size()] = static_cast<Integer::LimbType>(carry);
+        }
+        Trim(result);
+        return result;
+    }
+
+    // returns the remainder
+    Integer::LimbType DivideBySmall(const Magnitude& lhs,
+                                    Integer::LimbType rhs,
+                                    Magnitude& quotient) {
+        quotient.resize(lhs.size());
+        uint64_t remainder = 0;
+        for (size_t i = lhs.size(); i-- > 0;) {
+            uint64_t current = (remainder << kLimbBits) | lhs[i];
+            quotient[i] = static_cast<Integer::LimbType>(current / rhs);
+            remainder = current % rhs;
+        }
+        Trim(quotient);
+        return static_cast<Integer::LimbType>(remainder);
+    }
+
+    // Knuth's algorithm D, as in Hacker's Delight (divmnu)
+    void DivideMagnitudes(const Magnitude& lhs, const Magnitude& rhs,
+                          Magnitude& quotient, Magnitude& remainder) {
+        assert(!rhs.empty() && "Can't divide by zero");
+        if (CompareMagnitudes(lhs, rhs) < 0) {
+            quotient.clear();
+            remainder = lhs;
+            return;
+        }
+        if (rhs.size() == 1) {
+            remainder = FromUnsigned(DivideBySmall(lhs, rhs[0], quotient));
+            return;
+        }
+
+        size_t n = rhs.size();
+        size_t m = lhs.size();
+        int shift = std::countl_zero(rhs.back());
+
+        // normalized so that the top limb of the divisor has its high bit set
+        Magnitude v(n);
+        for (size_t i = n - 1; i > 0; i--) {
+            v[i] = static_cast<Integer::LimbType>(
+                (static_cast<uint64_t>(rhs[i]) << shift) |
+                (static_cast<uint64_t>(rhs[i - 1]) >> (kLimbBits - shift)));
+        }
+        v[0] = rhs[0] << shift;
+        Magnitude u(m + 1);
+        u[m] = static_cast<Integer::LimbType>(
+            static_cast<uint64_t>(lhs[m - 1]) >> (kLimbBits - shift));
+        for (size_t i = m - 1; i > 0; i--) {
+            u[i] = static_cast<Integer::LimbType>(
+                (static_cast<uint64_t>(lhs[i]) << shift) |
+                (static_cast<uint64_t>(lhs[i - 1]) >> (kLimbBits - shift)));
+        }
+        u[0] = lhs[0] << shift;
+
+        quotient.assign(m - n + 1, 0);
+        for (size_t j = m - n + 1; j-- > 0;) {
+            uint64_t numerator =
+                (static_cast<uint64_t>(u[j + n]) << kLimbBits) | u[j + n - 1];
+            uint64_t qhat = numerator / v[n - 1];
+            uint64_t rhat = numerator % v[n - 1];
+            while (qhat > kLimbMask ||
+                   qhat * v[n - 2] > ((rhat << kLimbBits) | u[j + n - 2])) {
+                qhat--;
+                rhat += v[n - 1];
+                if (rhat > kLimbMask) {
+                    break;
+                }
+            }
+
+            int64_t borrow = 0;
+            int64_t diff = 0;
+            for (size_t i = 0; i < n; i++) {
+                uint64_t product = qhat * v[i];
+                diff = static_cast<int64_t>(u[i + j]) - borrow -
+                       static_cast<int64_t>(product & kLimbMask);
+                u[i + j] = static_cast<Integer::LimbType>(diff);
+                borrow = static_cast<int64_t>(product >> kLimbBits) -
+                         (diff >> kLimbBits);
+            }
+            diff = static_cast<int64_t>(u[j + n]) - borrow;
+            u[j + n] = static_cast<Integer::LimbType>(diff);
+
+            quotient[j] = static_cast<Integer::LimbType>(qhat);
+            if (diff < 0) {
+                // qhat was one too large, add the divisor back
+                quotient[j]--;
+                uint64_t carry = 0;
+                for (size_t i = 0; i < n; i++) {
+                    uint64_t sum =
+                        static_cast<uint64_t>(u[i + j]) + v[i] + carry;
+                    u[i + j] = static_cast<Integer::LimbType>(sum);
+                    carry = sum >> kLimbBits;
+                }
+                u[j + n] += static_cast<Integer::LimbType>(carry);
+            }
+        }
+        Trim(quotient);
+
+        remainder.resize(n);
+        for (size_t i = 0; i < n; i++) {
+            remainder[i] = static_cast<Integer::LimbType>(
+                (static_cast<uint64_t>(u[i]) >> shift) |
+                (static_cast<uint64_t>(u[i + 1]) << (kLimbBits - shift)));
+        }
+        Trim(remainder);
+    }
+
+    uint64_t GetAbs(Integer::SmallType value) {
+        return value < 0 ? 0 - static_cast<uint64_t>(value)
+                         : static_cast<uint64_t>(value);
+    }
+}  // namespace
+
+Integer::Integer(std::string_view decimal) {
+    bool is_negative = false;
+    if (!decimal.empty() && (decimal[0] == '-' || decimal[0] == '+')) {
+        is_negative = decimal[0] == '-';
+        decimal.remove_prefix(1);
+    }
+    assert(!decimal.empty() && "Number has no digits");
+
+    // nine digits at a time fit a limb
+    constexpr size_t kChunk = 9;
+    size_t first = decimal.size() % kChunk == 0 ? kChunk
+                                                : decimal.size() % kChunk;
+    for (size_t begin = 0; begin < decimal.size();) {
+        size_t length = begin == 0 ? first : kChunk;
+        SmallType chunk = 0;
+        SmallType scale = 1;
+        for (size_t i = begin; i < begin + length; i++) {
+            assert(decimal[i] >= '0' && decimal[i] <= '9' &&
+                   "Not a decimal digit");
+            chunk = chunk * 10 + (decimal[i] - '0');
+            scale *= 10;
+        }
+        *this *= scale;
+        *this += chunk;
+        begin += length;
+    }
+    if (is_negative) {
+        *this = -*this;
+    }
+}
+
+int Integer::GetSign() const {
+    if (!IsSmall()) {
+        return is_negative_ ? -1 : 1;
+    }
+    return (small_ > 0) - (small_ < 0);
+}
+
+Integer::SmallType Integer::GetSmall() const {
+    assert(IsSmall() && "Value does not fit int64_t");
+    return small_;
+}
+
+Integer Integer::operator-() const {
+    if (IsSmall() && small_ != std::numeric_limits<SmallType>::min()) {
+        return Integer(-small_);
+    }
+    Integer result;
+    result.Assign(GetMagnitude(), GetSign() > 0);
+    return result;
+}
+
+Integer Integer::Abs() const {
+    return GetSign() < 0 ? -*this : *this;
+}
+
+Integer& Integer::operator/=(const Integer& other) {
+    Divide(other, this, nullptr);
+    return *this;
+}
+
+Integer& Integer::operator%=(const Integer& other) {
+    Divide(other, nullptr, this);
+    return *this;
+}
+
+Integer Integer::operator+(const Integer& other) const {
+    Integer temp(*this);
+    temp += other;
+    return temp;
+}
+
+Integer Integer::operator-(const Integer& other) const {
+    Integer temp(*this);
+    temp -= other;
+    return temp;
+}
+
+Integer Integer::operator*(const Integer& other) const {
+    Integer temp(*this);
+    temp *= other;
+    return temp;
+}
+
+Integer Integer::operator/(const Integer& other) const {
+    Integer temp(*this);
+    temp /= other;
+    return temp;
+}
+
+Integer Integer::operator%(const Integer& other) const {
+    Integer temp(*this);
+    temp %= other;
+    return temp;
+}
+
+bool Integer::operator<(const Integer& other) const {
+    return Compare(other) < 0;
+}
+
+bool Integer::operator<=(const Integer& other) const {
+    return Compare(other) <= 0;
+}
+
+bool Integer::operator>(const Integer& other) const {
+    return Compare(other) > 0;
+}
+
+bool Integer::operator>=(const Integer& other) const {
+    return Compare(other) >= 0;
+}
+
+std::string Integer::ToString() const {
+    if (IsSmall()) {
+        return std::to_string(small_);
+    }
+
+    // base 10^9 digits, least significant first
+    constexpr Integer::LimbType kBase = 1'000'000'000;
+    std::vector<Integer::LimbType> chunks;
+    Magnitude value = limbs_;
+    while (!value.empty()) {
+        Magnitude quotient;
+        chunks.push_back(DivideBySmall(value, kBase, quotient));
+        value = std::move(quotient);
+    }
+
+    std::string result = is_negative_ ? "-" : "";
+    result += std::to_string(chunks.back());
+    for (size_t i = chunks.size() - 1; i-- > 0;) {
+        std::string chunk = std::to_string(chunks[i]);
+        result.append(9 - chunk.size(), '0');
+        result += chunk;
+    }
+    return result;
+}
+
+Integer Gcd(const Integer& lhs, const Integer& rhs) {
+    if (lhs.IsSmall() && rhs.IsSmall()) {
+        Integer result;
+        result.Assign(
+            FromUnsigned(std::gcd(GetAbs(lhs.small_), GetAbs(rhs.small_))),
+            false);
+        return result;
+    }
+
+    Integer x = lhs.Abs();
+    Integer y = rhs.Abs();
+    while (!y.IsZero()) {
+        x %= y;
+        std::swap(x, y);
+    }
+    return x;
+}
+
+Integer& Integer::AddSlow(const Integer& other, bool is_subtraction) {
+    bool lhs_negative = GetSign() < 0;
+    bool rhs_negative = (other.GetSign() < 0) != is_subtraction;
+    Magnitude lhs = GetMagnitude();
+    Magnitude rhs = other.GetMagnitude();
+
+    if (lhs_negative == rhs_negative) {
+        Assign(AddMagnitudes(lhs, rhs), lhs_negative);
+    } else if (CompareMagnitudes(lhs, rhs) >= 0) {
+        Assign(SubtractMagnitudes(lhs, rhs), lhs_negative);
+    } else {
+        Assign(SubtractMagnitudes(rhs, lhs), rhs_negative);
+    }
+    return *this;
+}
+
+Integer& Integer::MultiplySlow(const Integer& other) {
+    bool is_negative = (GetSign() < 0) != (other.GetSign() < 0);
+    Assign(MultiplyMagnitudes(GetMagnitude(), other.GetMagnitude()),
+           is_negative);
+    return *this;
+}
+
+void Integer::Divide(const Integer& other, Integer* quotient,
+                     Integer* remainder) const {
+    assert(!other.IsZero() && "Can't divide by zero");
+    if (IsSmall() && other.IsSmall() &&
+        !(small_ == std::numeric_limits<SmallType>::min() &&
+          other.small_ == -1)) {
+        SmallType q = small_ / other.small_;
+        SmallType r = small_ % other.small_;
+        if (quotient) {
+            *quotient = Integer(q);
+        }
+        if (remainder) {
+            *remainder = Integer(r);
+        }
+        return;
+    }
+
+    bool lhs_negative = GetSign() < 0;
+    bool rhs_negative = other.GetSign() < 0;
+    Magnitude q;
+    Magnitude r;
+    DivideMagnitudes(GetMagnitude(), other.GetMagnitude(), q, r);
+    if (quotient) {
+        quotient->Assign(std::move(q), lhs_negative != rhs_negative);
+    }
+    if (remainder) {
+        remainder->Assign(std::move(r), lhs_negative);
+    }
+}
+
+Integer::Magnitude Integer::GetMagnitude() const {
+    if (IsSmall()) {
+        return FromUnsigned(GetAbs(small_));
+    }
+    return limbs_;
+}
+
+void Integer::Assign(Magnitude&& magnitude, bool is_negative) {
+    Trim(magnitude);
+    if (magnitude.size() <= 2) {
+        uint64_t value = 0;
+        for (size_t i = magnitude.size(); i-- > 0;) {
+            value = (value << kLimbBits) | magnitude[i];
+        }
+        constexpr uint64_t kMaxPositive = std::numeric_limits<SmallType>::max();
+        if (value <= kMaxPositive + is_negative) {
+            small_ = is_negative ? static_cast<SmallType>(0 - value)
+                                 : static_cast<SmallType>(value);
+            is_negative_ = false;
+            limbs_.clear();
+            return;
+        }
+    }
+    small_ = 0;
+    is_negative_ = is_negative;
+    limbs_ = std::move(magnitude);
+}
+
+int Integer::Compare(const Integer& other) const {
+    if (IsSmall() && other.IsSmall()) {
+        return (small_ > other.small_) - (small_ < other.small_);
+    }
+    int lhs_sign = GetSign();
+    int rhs_sign = other.GetSign();
+    if (lhs_sign != rhs_sign) {
+        return lhs_sign < rhs_sign ? -1 : 1;
+    }
+    int result = CompareMagnitudes(GetMagnitude(), other.GetMagnitude());
+    return lhs_sign < 0 ? -result : result;
+}
+
+}  // namespace Groebner
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cinttypes>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Groebner {
+
+// Arbitrary-precision integer. Values that fit int64_t are kept inline and
+// handled by checked machine arithmetic, a result that overflows is promoted
+// to a vector of limbs and demoted back as soon as it fits again.
+class Integer {
+    public:
+        using SmallType = int64_t;
+        using LimbType = uint32_t;
+
+        Integer(SmallType value = 0) : small_(value) {}
+        // optional sign followed by decimal digits
+        explicit Integer(std::string_view decimal);
+
+        bool IsZero() const { return IsSmall() && small_ == 0; }
+        bool IsSmall() const { return limbs_.empty(); }
+        // -1, 0 or 1
+        int GetSign() const;
+        // value itself, defined only when IsSmall()
+        SmallType GetSmall() const;
+
+        Integer operator-() const;
+        Integer operator+() const { return *this; }
+        Integer Abs() const;
+
+        Integer& operator+=(const Integer& other) {
+            SmallType result;
+            if (IsSmall() && other.IsSmall() &&
+                !__builtin_add_overflow(small_, other.small_, &result)) {
+                small_ = result;
+                return *this;
+            }
+            return AddSlow(other, false);
+        }
+
+        Integer& operator-=(const Integer& other) {
+            SmallType result;
+            if (IsSmall() && other.IsSmall() &&
+                !__builtin_sub_overflow(small_, other.small_, &result)) {
+                small_ = result;
+                return *this;
+            }
+            return AddSlow(other, true);
+        }
+
+        Integer& operator*=(const Integer& other) {
+            SmallType result;
+            if (IsSmall() && other.IsSmall() &&
+                !__builtin_mul_overflow(small_, other.small_, &result)) {
+                small_ = result;
+                return *this;
+            }
+            return MultiplySlow(other);
+        }
+
+        // quotient is truncated toward zero,
+        // remainder has the sign of the dividend, as for int64_t
+        Integer& operator/=(const Integer& other);
+        Integer& operator%=(const Integer& other);
+
+        Integer operator+(const Integer& other) const;
+        Integer operator-(const Integer& other) const;
+        Integer operator*(const Integer& other) const;
+        Integer operator/(const Integer& other) const;
+        Integer operator%(const Integer& other) const;
+
+        bool operator==(const Integer& other) const {
+            return small_ == other.small_ && limbs_ == other.limbs_ &&
+                   is_negative_ == other.is_negative_;
+        }
+        bool operator!=(const Integer& other) const {
+            return !(*this == other);
+        }
+        bool operator<(const Integer& other) const;
+        bool operator<=(const Integer& other) const;
+        bool operator>(const Integer& other) const;
+        bool operator>=(const Integer& other) const;
+
+        std::string ToString() const;
+
+        // non-negative, Gcd(0, 0) = 0
+        friend Integer Gcd(const Integer& lhs, const Integer& rhs);
+
+    private:
+        // absolute value, least significant limb first, no leading zeros
+        using Magnitude = std::vector<LimbType>;
+
+        Integer& AddSlow(const Integer& other, bool is_subtraction);
+        Integer& MultiplySlow(const Integer& other);
+        void Divide(const Integer& other, Integer* quotient,
+                    Integer* remainder) const;
+
+        Magnitude GetMagnitude() const;
+        void Assign(Magnitude&& magnitude, bool is_negative);
+        int Compare(const Integer& other) const;
+
+        // limbs_ is empty when the value fits small_, then small_ holds it,
+        // otherwise small_ is zero and the sign is kept in is_negative_
+        SmallType small_ = 0;
+        bool is_negative_ = false;
+        Magnitude limbs_;
+};
+
+}  // namespace Groebner
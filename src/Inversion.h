@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Accumulator.h"
+#include "FieldFwd.h"
+
+#include <cassert>
+#include <span>
+#include <vector>
+
+namespace Groebner::Details {
+// Replaces every value by its inverse, all values must be non-zero.
+// Prime fields use Montgomery's trick: with prefix products
+// p_i = v_0 ... v_i one inversion of p_{n-1} and 3(n-1) multiplications
+// give every v_i^{-1} = p_{i-1} * p_i^{-1}. Other fields invert one by
+// one, as the products of rationals would only grow.
+template <IsSupportedField Field>
+void InvertBatch(std::span<Field> values) {
+    if (values.empty()) {
+        return;
+    }
+
+    if constexpr (kIsPrimeFieldV<Field>) {
+        std::vector<Field> prefix(values.size());
+        prefix[0] = values[0];
+        for (size_t i = 1; i < values.size(); i++) {
+            assert(!values[i].IsZero() && "No inverse element for zero");
+            prefix[i] = prefix[i - 1] * values[i];
+        }
+
+        // inverse of v_0 ... v_i, walking i down
+        Field inverse = Field(1) / prefix.back();
+        for (size_t i = values.size() - 1; i > 0; i--) {
+            Field value_inverse = inverse * prefix[i - 1];
+            inverse *= values[i];
+            values[i] = value_inverse;
+        }
+        values[0] = inverse;
+    } else {
+        for (Field& value : values) {
+            value = Field(1) / value;
+        }
+    }
+}
+}  // namespace Groebner::Details
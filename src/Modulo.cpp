@@ -1,22 +1,41 @@
 #include "Modulo.h"
 
+#include <utility>
+
 namespace Groebner::Details {
 
+// iterative, invariant: old_r = old_s x + old_t y and r = s x + t y
 ModuloValueType FindGcdExtended(ModuloValueType x, ModuloValueType y,
                                 ModuloValueType* coef_x,
                                 ModuloValueType* coef_y) {
     assert(coef_x && coef_y);
 
-    if (x == 0) {
-        *coef_x = 0;
-        *coef_y = 1;
-        return y;
+    ModuloValueType old_r = x, r = y;
+    ModuloValueType old_s = 1, s = 0;
+    ModuloValueType old_t = 0, t = 1;
+    while (r != 0) {
+        ModuloValueType quotient = old_r / r;
+        old_r = std::exchange(r, old_r - quotient * r);
+        old_s = std::exchange(s, old_s - quotient * s);
+        old_t = std::exchange(t, old_t - quotient * t);
     }
+    *coef_x = old_s;
+    *coef_y = old_t;
+    return old_r;
+}
 
-    ModuloValueType temp_x, temp_y;
-    ModuloValueType gcd = FindGcdExtended(y % x, x, &temp_x, &temp_y);
-    *coef_x = temp_y - (y / x) * temp_x;
-    *coef_y = temp_x;
-    return gcd;
+// i^{-1} = -(p / i) * (p mod i)^{-1}, as p = (p / i) i + p mod i
+std::vector<ModuloValueType> BuildInverseTable(ModuloValueType modulus,
+                                               ModuloValueType size) {
+    assert(0 < size && size <= modulus);
+    std::vector<ModuloValueType> table(size);
+    if (size > 1) {
+        table[1] = 1;
+    }
+    for (ModuloValueType i = 2; i < size; i++) {
+        table[i] = static_cast<ModuloValueType>(
+            MultiplyModulo(modulus - modulus / i, table[modulus % i], modulus));
+    }
+    return table;
 }
 }  // namespace Groebner::Details
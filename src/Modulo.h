@@ -3,28 +3,184 @@
 #include <cassert>
 #include <cinttypes>
 #include <cstdlib>
+#include <limits>
+#include <type_traits>
+#include <vector>
 
 namespace Groebner {
 namespace Details {
+    constexpr uint64_t MultiplyModulo(uint64_t lhs, uint64_t rhs,
+                                      uint64_t modulus) {
+        return static_cast<uint64_t>(static_cast<unsigned __int128>(lhs) *
+                                     rhs % modulus);
+    }
+
+    constexpr uint64_t PowerModulo(uint64_t base, uint64_t exponent,
+                                   uint64_t modulus) {
+        uint64_t result = 1 % modulus;
+        base %= modulus;
+        for (; exponent > 0; exponent >>= 1) {
+            if (exponent & 1) {
+                result = MultiplyModulo(result, base, modulus);
+            }
+            base = MultiplyModulo(base, base, modulus);
+        }
+        return result;
+    }
+
+    // Miller-Rabin, the first twelve primes as bases are a deterministic
+    // test for every n < 2^64
     constexpr bool IsPrime(int64_t n) {
-        if (n <= 1 || (n > 2 && n % 2 == 0)) {
+        constexpr uint64_t kBases[] = {2,  3,  5,  7,  11, 13,
+                                       17, 19, 23, 29, 31, 37};
+        if (n <= 1) {
             return false;
         }
+        for (uint64_t base : kBases) {
+            if (static_cast<uint64_t>(n) % base == 0) {
+                return static_cast<uint64_t>(n) == base;
+            }
+        }
 
-        for (size_t i = 3; i * i <= n; i++) {
-            if (n % i == 0) {
+        uint64_t odd = n - 1;
+        int twos = 0;
+        for (; odd % 2 == 0; odd /= 2) {
+            twos++;
+        }
+        for (uint64_t base : kBases) {
+            uint64_t x = PowerModulo(base, odd, n);
+            if (x == 1 || x == static_cast<uint64_t>(n - 1)) {
+                continue;
+            }
+            bool is_witness = true;
+            for (int i = 1; i < twos && is_witness; i++) {
+                x = MultiplyModulo(x, x, n);
+                is_witness = x != static_cast<uint64_t>(n - 1);
+            }
+            if (is_witness) {
                 return false;
             }
         }
-
         return true;
     }
 
     using ModuloValueType = int64_t;
 
+    // Barrett reduction: x < 2^64 is reduced by a modulus below 2^32 with
+    // one 64x64->128 multiplication by floor(2^64 / modulus) instead of a
+    // division, the estimated quotient is at most one short.
+    constexpr inline uint64_t kBarrettLimit = uint64_t(1) << 32;
+
+    class BarrettReducer {
+        public:
+            constexpr explicit BarrettReducer(uint64_t modulus)
+                : modulus_(modulus),
+                  factor_(static_cast<uint64_t>(
+                      (static_cast<unsigned __int128>(1) << 64) / modulus)) {}
+
+            uint64_t Reduce(uint64_t x) const {
+                uint64_t quotient = static_cast<uint64_t>(
+                    (static_cast<unsigned __int128>(x) * factor_) >> 64);
+                uint64_t result = x - quotient * modulus_;
+                return result - (modulus_ & -uint64_t(result >= modulus_));
+            }
+
+            uint64_t Multiply(uint64_t lhs, uint64_t rhs) const {
+                return Reduce(lhs * rhs);
+            }
+
+            // any 128-bit x as hi 2^64 + lo, 2^64 mod modulus is
+            // 2^64 - factor * modulus
+            uint64_t ReduceWide(unsigned __int128 x) const {
+                uint64_t high = Reduce(static_cast<uint64_t>(x >> 64));
+                uint64_t low = Reduce(static_cast<uint64_t>(x));
+                return Reduce(Multiply(high, 0 - factor_ * modulus_) + low);
+            }
+
+        private:
+            uint64_t modulus_;
+            uint64_t factor_;
+    };
+
+    // Larger odd moduli, up to 2^63, multiply through Montgomery reduction
+    // with R = 2^64: REDC(a * b) = a b / R, and multiplying that by R^2
+    // in a second REDC gives a b back in normal form. Two multiplications
+    // by constants replace the 128-bit division the product would need.
+    class MontgomeryReducer {
+        public:
+            constexpr explicit MontgomeryReducer(uint64_t modulus)
+                : modulus_(modulus),
+                  negative_inverse_(GetNegativeInverse(modulus)),
+                  squared_r_(static_cast<uint64_t>(
+                      -static_cast<unsigned __int128>(modulus) % modulus)) {}
+
+            // x < modulus * 2^64, returns x / 2^64 mod modulus
+            uint64_t Reduce(unsigned __int128 x) const {
+                uint64_t factor = static_cast<uint64_t>(x) * negative_inverse_;
+                uint64_t result = static_cast<uint64_t>(
+                    (x + static_cast<unsigned __int128>(factor) * modulus_) >>
+                    64);
+                return result - (modulus_ & -uint64_t(result >= modulus_));
+            }
+
+            uint64_t Multiply(uint64_t lhs, uint64_t rhs) const {
+                uint64_t scaled =
+                    Reduce(static_cast<unsigned __int128>(lhs) * rhs);
+                return Reduce(static_cast<unsigned __int128>(scaled) *
+                              squared_r_);
+            }
+
+            // any 128-bit x, the high word is brought below the modulus
+            // by one 64-bit division first, REDC(x) = x / R is then
+            // multiplied back by R^2
+            uint64_t ReduceWide(unsigned __int128 x) const {
+                uint64_t high = static_cast<uint64_t>(x >> 64);
+                if (high >= modulus_) {
+                    high %= modulus_;
+                    x = (static_cast<unsigned __int128>(high) << 64) |
+                        static_cast<uint64_t>(x);
+                }
+                return Reduce(static_cast<unsigned __int128>(Reduce(x)) *
+                              squared_r_);
+            }
+
+        private:
+            // -modulus^{-1} mod 2^64 by Newton iteration, every step
+            // doubles the number of correct low bits
+            static constexpr uint64_t GetNegativeInverse(uint64_t modulus) {
+                uint64_t inverse = modulus;
+                for (int i = 0; i < 6; i++) {
+                    inverse *= 2 - modulus * inverse;
+                }
+                return 0 - inverse;
+            }
+
+            uint64_t modulus_;
+            uint64_t negative_inverse_;
+            // 2^128 mod modulus
+            uint64_t squared_r_;
+    };
+
+    // Elements are stored in the narrowest type holding [0, modulus):
+    // 16 bits for moduli up to 2^16, 32 bits below 2^32, where products
+    // still fit the 64 bits Barrett reduction works with, and ModuloValueType
+    // otherwise. Products are always formed in 64 bits or wider.
+    template <int64_t Modulus>
+    using ModuloStorageType = std::conditional_t<
+        Modulus <= (int64_t(1) << 16), uint16_t,
+        std::conditional_t<(Modulus < int64_t(kBarrettLimit)), uint32_t,
+                           ModuloValueType>>;
+
     ModuloValueType FindGcdExtended(ModuloValueType x, ModuloValueType y,
                                     ModuloValueType* coef_x,
                                     ModuloValueType* coef_y);
+
+    // inverses of 1..kInverseTableSize-1 are worth a table
+    constexpr inline ModuloValueType kInverseTableSize = 1 << 16;
+
+    // table[i] = i^{-1} mod modulus for 0 < i < size, size <= modulus
+    std::vector<ModuloValueType> BuildInverseTable(ModuloValueType modulus,
+                                                   ModuloValueType size);
 }  // namespace Details
 
 template <int64_t N>
@@ -34,8 +190,30 @@ template <int64_t Modulus>
 requires IsPrime<Modulus> class Modulo {
     public:
         using ValueType = Details::ModuloValueType;
+        using StorageType = Details::ModuloStorageType<Modulus>;
+
+        Modulo(ValueType value = 0) : value_(Normalize(value)) {}
+
+        static constexpr ValueType GetModulus() { return Modulus; }
 
-        Modulo(ValueType value = 0) : value_(value) { Normalize(); }
+        // element congruent to an unreduced non-negative value,
+        // such as a sum of products
+        static Modulo FromUnreduced(uint64_t value) {
+            Modulo result;
+            if constexpr (kIsSmall) {
+                result.value_ =
+                    static_cast<StorageType>(kReducer.Reduce(value));
+            } else {
+                result.value_ = static_cast<StorageType>(value % Modulus);
+            }
+            return result;
+        }
+        static Modulo FromUnreduced(unsigned __int128 value) {
+            Modulo result;
+            result.value_ =
+                static_cast<StorageType>(kReducer.ReduceWide(value));
+            return result;
+        }
 
         ValueType GetValue() const { return value_; }
 
@@ -45,32 +223,37 @@ requires IsPrime<Modulus> class Modulo {
             return *this;
         }
 
-        Modulo operator-() const { return Modulo<Modulus>(-value_); }
+        Modulo operator-() const {
+            Modulo result;
+            result.value_ =
+                Correct(static_cast<SignedType>(-SignedType(value_)));
+            return result;
+        }
         Modulo operator+() const { return *this; }
 
+        // both operands are reduced, so the sum or difference is one
+        // modulus off at most, the sign bit selects the correction
         Modulo& operator+=(const Modulo& other) {
-            value_ += other.value_;
-            Normalize();
+            value_ = Correct(static_cast<SignedType>(
+                SignedType(value_) + SignedType(other.value_ - Modulus)));
             return *this;
         }
 
         Modulo& operator-=(const Modulo& other) {
-            value_ -= other.value_;
-            Normalize();
+            value_ = Correct(static_cast<SignedType>(
+                SignedType(value_) - SignedType(other.value_)));
             return *this;
         }
 
         Modulo& operator*=(const Modulo& other) {
-            value_ *= other.value_;
-            Normalize();
+            value_ = static_cast<StorageType>(
+                kReducer.Multiply(value_, other.value_));
             return *this;
         }
 
         Modulo& operator/=(const Modulo& other) {
             assert(other.value_ != 0 && "Can't divide by zero");
-            value_ *= other.GetInverse().value_;
-            Normalize();
-            return *this;
+            return *this *= other.GetInverse();
         }
 
         Modulo operator+(const Modulo& other) const {
@@ -116,22 +299,66 @@ requires IsPrime<Modulus> class Modulo {
         bool operator>=(const Modulo& other) const { return other <= *this; }
 
     private:
-        void Normalize() {
-            if (value_ < 0) {
-                value_ = (value_ % Modulus + Modulus) % Modulus;
+        static constexpr bool kIsSmall = Modulus < Details::kBarrettLimit;
+        // sums and differences of reduced values, in (-Modulus, Modulus),
+        // fit the signed type of the storage width when the modulus leaves
+        // its top bit free, so they vectorize in narrow lanes
+        using SignedType = std::conditional_t<
+            std::is_unsigned_v<StorageType> &&
+                Modulus - 1 <= std::numeric_limits<StorageType>::max() / 2,
+            std::make_signed_t<StorageType>, ValueType>;
+        static constexpr auto kReducer = [] {
+            if constexpr (kIsSmall) {
+                return Details::BarrettReducer(Modulus);
             } else {
-                value_ = value_ % Modulus;
+                return Details::MontgomeryReducer(Modulus);
+            }
+        }();
+
+        // value + Modulus for a value in [-Modulus, 0)
+        template <typename Signed>
+        static StorageType Correct(Signed value) {
+            constexpr int kSignShift = sizeof(Signed) * 8 - 1;
+            value += static_cast<Signed>(Modulus) & (value >> kSignShift);
+            return static_cast<StorageType>(value);
+        }
+
+        static StorageType Normalize(ValueType value) {
+            if constexpr (kIsSmall) {
+                uint64_t magnitude = value < 0
+                                         ? 0 - static_cast<uint64_t>(value)
+                                         : static_cast<uint64_t>(value);
+                ValueType reduced = kReducer.Reduce(magnitude);
+                return Correct(value < 0 ? -reduced : reduced);
+            } else {
+                return Correct(value % Modulus);
             }
         }
 
         Modulo GetNormalized() { return Modulo(*this); }
 
+        // small fields look every inverse up, built on first division
+        static constexpr bool kHasInverseTable =
+            Modulus <= Details::kInverseTableSize;
+
+        static const std::vector<StorageType>& GetInverseTable() {
+            static const std::vector<StorageType> table = [] {
+                auto inverses = Details::BuildInverseTable(Modulus, Modulus);
+                return std::vector<StorageType>(inverses.begin(),
+                                                inverses.end());
+            }();
+            return table;
+        }
+
         void Inverse() {
             assert(value_ != 0 && "No inverse element for zero");
+            if constexpr (kHasInverseTable) {
+                value_ = GetInverseTable()[value_];
+                return;
+            }
             ValueType x, y;
             Details::FindGcdExtended(value_, Modulus, &x, &y);
-            value_ = x;
-            Normalize();
+            value_ = Normalize(x);
         }
 
         Modulo GetInverse() const {
@@ -142,7 +369,7 @@ requires IsPrime<Modulus> class Modulo {
 
         // considering modulus_ to be positive and prime
         // 0 <= value_ < Modulus
-        ValueType value_;
+        StorageType value_;
 };
 
 }  // namespace Groebner
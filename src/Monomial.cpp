@@ -6,18 +6,32 @@
 
 namespace Groebner {
 
-Monomial::Monomial(size_t size) : degrees_(size) {}
+Monomial::Monomial(size_t size, const allocator_type& alloc)
+    : degrees_(size, alloc) {}
 
-Monomial::Monomial(std::vector<DegreeType>&& degrees)
-    : degrees_(std::move(degrees)) {
+Monomial::Monomial(std::vector<DegreeType>&& degrees,
+                   const allocator_type& alloc)
+    : degrees_(degrees.begin(), degrees.end(), alloc) {
     sum_degree_ = std::accumulate(degrees_.begin(), degrees_.end(), 0ULL);
 }
 
-Monomial::Monomial(std::initializer_list<DegreeType> degrees) {
-    degrees_.insert(degrees_.end(), degrees.begin(), degrees.end());
+Monomial::Monomial(std::initializer_list<DegreeType> degrees,
+                   const allocator_type& alloc)
+    : degrees_(degrees, alloc) {
     sum_degree_ = std::accumulate(degrees_.begin(), degrees_.end(), 0ULL);
 }
 
+Monomial::Monomial(const Monomial& other, const allocator_type& alloc)
+    : sum_degree_(other.sum_degree_), degrees_(other.degrees_, alloc) {}
+
+Monomial::Monomial(Monomial&& other, const allocator_type& alloc)
+    : sum_degree_(other.sum_degree_),
+      degrees_(std::move(other.degrees_), alloc) {}
+
+Monomial::allocator_type Monomial::get_allocator() const {
+    return degrees_.get_allocator();
+}
+
 size_t Monomial::GetSize() const {
     return degrees_.size();
 }
@@ -93,6 +107,16 @@ bool Monomial::IsDivisible(const Monomial& other) const {
     return StraightCoordinateOrder::IsGreaterOrEqual(*this, other);
 }
 
+Monomial::MaskType Monomial::GetDivisibilityMask() const {
+    MaskType mask = 0;
+    for (size_t i = 0; i < GetSize(); i++) {
+        if (degrees_[i] != 0) {
+            mask |= MaskType(1) << (i % 64);
+        }
+    }
+    return mask;
+}
+
 void Monomial::Expand(size_t new_size) {
     assert(new_size >= GetSize() && "Trying to expand to lower size");
     degrees_.resize(new_size);
@@ -2,7 +2,9 @@
 
 #include <cinttypes>
 #include <iterator>
+#include <memory_resource>
 #include <numeric>
+#include <span>
 #include <vector>
 
 #include "IteratorFwd.h"
@@ -12,22 +14,40 @@ namespace Groebner {
 class Monomial {
     public:
         using DegreeType = uint64_t;
+        using MaskType = uint64_t;
+        // degrees are allocated from the given memory resource,
+        // containers pass theirs on through uses-allocator construction
+        using allocator_type = std::pmr::polymorphic_allocator<DegreeType>;
 
-        Monomial(size_t size = 0);
-        explicit Monomial(std::vector<DegreeType>&& degrees);
-        Monomial(std::initializer_list<DegreeType> degrees);
+        Monomial(size_t size = 0, const allocator_type& alloc = {});
+        explicit Monomial(std::vector<DegreeType>&& degrees,
+                          const allocator_type& alloc = {});
+        Monomial(std::initializer_list<DegreeType> degrees,
+                 const allocator_type& alloc = {});
 
         template <Details::IsIterator It>
-        Monomial(It begin, It end) {
-            degrees_.insert(degrees_.end(), begin, end);
+        Monomial(It begin, It end, const allocator_type& alloc = {})
+            : degrees_(begin, end, alloc) {
             sum_degree_ =
                 std::accumulate(degrees_.begin(), degrees_.end(), 0ULL);
         }
 
+        Monomial(const Monomial& other) = default;
+        Monomial(Monomial&& other) = default;
+        Monomial(const Monomial& other, const allocator_type& alloc);
+        Monomial(Monomial&& other, const allocator_type& alloc);
+
+        Monomial& operator=(const Monomial& other) = default;
+        Monomial& operator=(Monomial&& other) = default;
+
+        allocator_type get_allocator() const;
+
         size_t GetSize() const;
         DegreeType GetSumDegree() const;
 
         DegreeType GetDegree(size_t ind) const;
+        // degrees past GetSize() are zeros and are not stored
+        std::span<const DegreeType> GetDegrees() const { return degrees_; }
         void SetDegree(size_t ind, DegreeType val);
 
         Monomial& operator+=(const Monomial& other);
@@ -41,10 +61,14 @@ class Monomial {
 
         bool IsDivisible(const Monomial& other) const;
 
+        // bit (i % 64) is set if variable i has non-zero degree,
+        // so lhs can be divisible by rhs only if rhs mask is a subset of lhs
+        MaskType GetDivisibilityMask() const;
+
     private:
         void Expand(size_t new_size);
 
         DegreeType sum_degree_ = 0;
-        std::vector<DegreeType> degrees_;
+        std::pmr::vector<DegreeType> degrees_;
 };
 }  // namespace Groebner
@@ -2,57 +2,268 @@
 
 #include "Monomial.h"
 
+#include <algorithm>
 #include <cassert>
+#include <compare>
 
 namespace Groebner {
 
+namespace Details {
+    using DegreeSpan = std::span<const Monomial::DegreeType>;
+
+    // Kernels work on raw degree arrays without bounds checks.
+    // Blocks are scanned with xor/or so the compiler can vectorize them,
+    // the exact position is then found inside the first differing block.
+    inline constexpr size_t kCompareBlock = 4;
+
+    // first index in [0, size) where lhs and rhs differ, size if none
+    inline size_t FindFirstMismatch(const Monomial::DegreeType* lhs,
+                                    const Monomial::DegreeType* rhs,
+                                    size_t size) {
+        size_t i = 0;
+        for (; i + kCompareBlock <= size; i += kCompareBlock) {
+            Monomial::DegreeType diff = 0;
+            for (size_t j = 0; j < kCompareBlock; ++j) {
+                diff |= lhs[i + j] ^ rhs[i + j];
+            }
+            if (diff != 0) {
+                break;
+            }
+        }
+        while (i < size && lhs[i] == rhs[i]) {
+            ++i;
+        }
+        return i;
+    }
+
+    // last index in [0, size) where lhs and rhs differ, size if none
+    inline size_t FindLastMismatch(const Monomial::DegreeType* lhs,
+                                   const Monomial::DegreeType* rhs,
+                                   size_t size) {
+        size_t i = size;
+        for (; i >= kCompareBlock; i -= kCompareBlock) {
+            Monomial::DegreeType diff = 0;
+            for (size_t j = 1; j <= kCompareBlock; ++j) {
+                diff |= lhs[i - j] ^ rhs[i - j];
+            }
+            if (diff != 0) {
+                break;
+            }
+        }
+        while (i > 0 && lhs[i - 1] == rhs[i - 1]) {
+            --i;
+        }
+        return i == 0 ? size : i - 1;
+    }
+
+    inline bool IsZeroRange(DegreeSpan degrees) {
+        Monomial::DegreeType any = 0;
+        for (auto degree : degrees) {
+            any |= degree;
+        }
+        return any == 0;
+    }
+
+    inline std::strong_ordering CompareLex(DegreeSpan lhs_degrees,
+                                           DegreeSpan rhs_degrees) {
+        size_t common = std::min(lhs_degrees.size(), rhs_degrees.size());
+
+        size_t pos =
+            FindFirstMismatch(lhs_degrees.data(), rhs_degrees.data(), common);
+        if (pos < common) {
+            return lhs_degrees[pos] <=> rhs_degrees[pos];
+        }
+        if (!IsZeroRange(lhs_degrees.subspan(common))) {
+            return std::strong_ordering::greater;
+        }
+        if (!IsZeroRange(rhs_degrees.subspan(common))) {
+            return std::strong_ordering::less;
+        }
+        return std::strong_ordering::equal;
+    }
+
+    // the first difference from the last variable decides,
+    // bigger degree there means smaller monomial
+    inline std::strong_ordering CompareReverseLex(DegreeSpan lhs_degrees,
+                                                  DegreeSpan rhs_degrees) {
+        size_t common = std::min(lhs_degrees.size(), rhs_degrees.size());
+
+        if (!IsZeroRange(lhs_degrees.subspan(common))) {
+            return std::strong_ordering::less;
+        }
+        if (!IsZeroRange(rhs_degrees.subspan(common))) {
+            return std::strong_ordering::greater;
+        }
+
+        size_t pos =
+            FindLastMismatch(lhs_degrees.data(), rhs_degrees.data(), common);
+        if (pos < common) {
+            return rhs_degrees[pos] <=> lhs_degrees[pos];
+        }
+        return std::strong_ordering::equal;
+    }
+}  // namespace Details
+
 class StraightCoordinateOrder {
     public:
         StraightCoordinateOrder() = delete;
-        static bool IsLess(const Monomial& lhs, const Monomial& rhs);
-        static bool IsGreater(const Monomial& lhs, const Monomial& rhs);
-        static bool IsEqual(const Monomial& lhs, const Monomial& rhs);
-        static bool IsLessOrEqual(const Monomial& lhs, const Monomial& rhs);
-        static bool IsGreaterOrEqual(const Monomial& lhs, const Monomial& rhs);
+
+        static bool IsLess(const Monomial& lhs, const Monomial& rhs) {
+            auto lhs_degrees = lhs.GetDegrees();
+            auto rhs_degrees = rhs.GetDegrees();
+            if (lhs_degrees.size() > rhs_degrees.size()) {
+                return false;
+            }
+
+            for (size_t i = 0; i < lhs_degrees.size(); ++i) {
+                if (lhs_degrees[i] >= rhs_degrees[i]) {
+                    return false;
+                }
+            }
+            return std::all_of(rhs_degrees.begin() + lhs_degrees.size(),
+                               rhs_degrees.end(),
+                               [](auto degree) { return degree > 0; });
+        }
+
+        static bool IsGreater(const Monomial& lhs, const Monomial& rhs) {
+            return IsLess(rhs, lhs);
+        }
+
+        static bool IsEqual(const Monomial& lhs, const Monomial& rhs) {
+            auto lhs_degrees = lhs.GetDegrees();
+            auto rhs_degrees = rhs.GetDegrees();
+            size_t common = std::min(lhs_degrees.size(), rhs_degrees.size());
+
+            return Details::FindFirstMismatch(lhs_degrees.data(),
+                                              rhs_degrees.data(),
+                                              common) == common &&
+                   Details::IsZeroRange(lhs_degrees.subspan(common)) &&
+                   Details::IsZeroRange(rhs_degrees.subspan(common));
+        }
+
+        static bool IsLessOrEqual(const Monomial& lhs, const Monomial& rhs) {
+            auto lhs_degrees = lhs.GetDegrees();
+            auto rhs_degrees = rhs.GetDegrees();
+            size_t common = std::min(lhs_degrees.size(), rhs_degrees.size());
+
+            bool is_less_or_equal = true;
+            for (size_t i = 0; i < common; ++i) {
+                is_less_or_equal &= lhs_degrees[i] <= rhs_degrees[i];
+            }
+            return is_less_or_equal &&
+                   Details::IsZeroRange(lhs_degrees.subspan(common));
+        }
+
+        static bool IsGreaterOrEqual(const Monomial& lhs,
+                                     const Monomial& rhs) {
+            return IsLessOrEqual(rhs, lhs);
+        }
 };
 
 class LexOrder : public StraightCoordinateOrder {
     public:
         LexOrder() = delete;
-        static bool IsLess(const Monomial& lhs, const Monomial& rhs);
-        static bool IsGreater(const Monomial& lhs, const Monomial& rhs);
-        static bool IsLessOrEqual(const Monomial& lhs, const Monomial& rhs);
-        static bool IsGreaterOrEqual(const Monomial& lhs, const Monomial& rhs);
+
+        static std::strong_ordering Compare(const Monomial& lhs,
+                                            const Monomial& rhs) {
+            return Details::CompareLex(lhs.GetDegrees(), rhs.GetDegrees());
+        }
+
+        static bool IsLess(const Monomial& lhs, const Monomial& rhs) {
+            return Compare(lhs, rhs) < 0;
+        }
+        static bool IsGreater(const Monomial& lhs, const Monomial& rhs) {
+            return Compare(lhs, rhs) > 0;
+        }
+        static bool IsLessOrEqual(const Monomial& lhs, const Monomial& rhs) {
+            return Compare(lhs, rhs) <= 0;
+        }
+        static bool IsGreaterOrEqual(const Monomial& lhs,
+                                     const Monomial& rhs) {
+            return Compare(lhs, rhs) >= 0;
+        }
 };
 
 class ReverseLexOrder : public StraightCoordinateOrder {
     public:
         ReverseLexOrder() = delete;
 
-        static bool IsLess(const Monomial& lhs, const Monomial& rhs);
-        static bool IsGreater(const Monomial& lhs, const Monomial& rhs);
-        static bool IsLessOrEqual(const Monomial& lhs, const Monomial& rhs);
-        static bool IsGreaterOrEqual(const Monomial& lhs, const Monomial& rhs);
+        static std::strong_ordering Compare(const Monomial& lhs,
+                                            const Monomial& rhs) {
+            return Details::CompareReverseLex(lhs.GetDegrees(),
+                                              rhs.GetDegrees());
+        }
+
+        static bool IsLess(const Monomial& lhs, const Monomial& rhs) {
+            return Compare(lhs, rhs) < 0;
+        }
+        static bool IsGreater(const Monomial& lhs, const Monomial& rhs) {
+            return Compare(lhs, rhs) > 0;
+        }
+        static bool IsLessOrEqual(const Monomial& lhs, const Monomial& rhs) {
+            return Compare(lhs, rhs) <= 0;
+        }
+        static bool IsGreaterOrEqual(const Monomial& lhs,
+                                     const Monomial& rhs) {
+            return Compare(lhs, rhs) >= 0;
+        }
 };
 
 class GrlexOrder : public LexOrder {
     public:
         GrlexOrder() = delete;
 
-        static bool IsLess(const Monomial& lhs, const Monomial& rhs);
-        static bool IsGreater(const Monomial& lhs, const Monomial& rhs);
-        static bool IsLessOrEqual(const Monomial& lhs, const Monomial& rhs);
-        static bool IsGreaterOrEqual(const Monomial& lhs, const Monomial& rhs);
+        static std::strong_ordering Compare(const Monomial& lhs,
+                                            const Monomial& rhs) {
+            if (auto cmp = lhs.GetSumDegree() <=> rhs.GetSumDegree();
+                cmp != 0) {
+                return cmp;
+            }
+            return Details::CompareLex(lhs.GetDegrees(), rhs.GetDegrees());
+        }
+
+        static bool IsLess(const Monomial& lhs, const Monomial& rhs) {
+            return Compare(lhs, rhs) < 0;
+        }
+        static bool IsGreater(const Monomial& lhs, const Monomial& rhs) {
+            return Compare(lhs, rhs) > 0;
+        }
+        static bool IsLessOrEqual(const Monomial& lhs, const Monomial& rhs) {
+            return Compare(lhs, rhs) <= 0;
+        }
+        static bool IsGreaterOrEqual(const Monomial& lhs,
+                                     const Monomial& rhs) {
+            return Compare(lhs, rhs) >= 0;
+        }
 };
 
 class GrevlexOrder : public ReverseLexOrder {
     public:
         GrevlexOrder() = delete;
 
-        static bool IsLess(const Monomial& lhs, const Monomial& rhs);
-        static bool IsGreater(const Monomial& lhs, const Monomial& rhs);
-        static bool IsLessOrEqual(const Monomial& lhs, const Monomial& rhs);
-        static bool IsGreaterOrEqual(const Monomial& lhs, const Monomial& rhs);
+        static std::strong_ordering Compare(const Monomial& lhs,
+                                            const Monomial& rhs) {
+            if (auto cmp = lhs.GetSumDegree() <=> rhs.GetSumDegree();
+                cmp != 0) {
+                return cmp;
+            }
+            return Details::CompareReverseLex(lhs.GetDegrees(),
+                                              rhs.GetDegrees());
+        }
+
+        static bool IsLess(const Monomial& lhs, const Monomial& rhs) {
+            return Compare(lhs, rhs) < 0;
+        }
+        static bool IsGreater(const Monomial& lhs, const Monomial& rhs) {
+            return Compare(lhs, rhs) > 0;
+        }
+        static bool IsLessOrEqual(const Monomial& lhs, const Monomial& rhs) {
+            return Compare(lhs, rhs) <= 0;
+        }
+        static bool IsGreaterOrEqual(const Monomial& lhs,
+                                     const Monomial& rhs) {
+            return Compare(lhs, rhs) >= 0;
+        }
 };
 
 }  // namespace Groebner
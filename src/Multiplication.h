@@ -0,0 +1,452 @@
+#pragma once
+
+#include "Accumulator.h"
+#include "ComparatorFwd.h"
+#include "FieldFwd.h"
+#include "Ntt.h"
+#include "RuntimeModulo.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <iterator>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Groebner::Details {
+// Product terms in decreasing order of the comparator, monomials distinct.
+// Coefficients may cancel to zero, the consumer drops them.
+template <IsSupportedField Field>
+using TermBuffer = std::vector<std::pair<Monomial, Field>>;
+
+// Stores the sum accumulated for the last term of out and restarts it,
+// the term is dropped if the sum is zero.
+template <IsSupportedField Field>
+void FlushLastTerm(Accumulator<Field>& sum, TermBuffer<Field>& out) {
+    out.back().second = sum.Get();
+    sum.Clear();
+    if (out.back().second.IsZero()) {
+        out.pop_back();
+    }
+}
+
+// (monomial, coef) entries of a polynomial, in decreasing order
+template <typename Range>
+using EntryPointers = std::vector<
+    std::add_pointer_t<const typename Range::ConstIterator::value_type>>;
+
+template <typename Range>
+EntryPointers<Range> CollectEntries(const Range& range) {
+    EntryPointers<Range> result;
+    result.reserve(range.GetSize());
+    for (const auto& entry : range) {
+        result.push_back(&entry);
+    }
+    return result;
+}
+
+// Box with at most this many cells per product term is considered dense.
+inline constexpr size_t kDenseFillFactor = 4;
+inline constexpr size_t kDenseMaxCells = size_t(1) << 20;
+
+// Johnson's multiplication: one stream lhs[i] * rhs[j], j = 0, 1, ...
+// per term of the shorter side, streams are merged through a max-heap.
+// Every stream yields decreasing monomials since orders are multiplicative,
+// so equal products leave the heap one after another and are summed in one
+// accumulator, reduced once per resulting term.
+template <IsComparator Comparator, IsSupportedField Field, typename Entry>
+void MultiplyHeap(const std::vector<Entry>& lhs, const std::vector<Entry>& rhs,
+                  TermBuffer<Field>& out) {
+    if (lhs.size() > rhs.size()) {
+        MultiplyHeap<Comparator>(rhs, lhs, out);
+        return;
+    }
+
+    struct Stream {
+            size_t pos = 0;
+            Monomial product;
+    };
+
+    // products are kept in place, the heap holds stream indices only
+    std::vector<Stream> streams(lhs.size());
+    std::vector<size_t> heap;
+    heap.reserve(lhs.size());
+    auto is_less = [&streams](size_t a, size_t b) {
+        return Comparator::IsLess(streams[a].product, streams[b].product);
+    };
+
+    for (size_t i = 0; i < lhs.size(); i++) {
+        streams[i].product = lhs[i]->first;
+        streams[i].product += rhs[0]->first;
+        heap.push_back(i);
+    }
+    std::make_heap(heap.begin(), heap.end(), is_less);
+
+    size_t first = out.size();
+    Accumulator<Field> sum;
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), is_less);
+        size_t i = heap.back();
+        auto& stream = streams[i];
+
+        if (out.size() == first || out.back().first != stream.product) {
+            if (out.size() != first) {
+                FlushLastTerm(sum, out);
+            }
+            out.emplace_back(stream.product, Field());
+        }
+        sum.AddProduct(lhs[i]->second, rhs[stream.pos]->second);
+
+        if (++stream.pos < rhs.size()) {
+            // assignment reuses the degree buffer of the stream
+            stream.product = lhs[i]->first;
+            stream.product += rhs[stream.pos]->first;
+            std::push_heap(heap.begin(), heap.end(), is_less);
+        } else {
+            heap.pop_back();
+        }
+    }
+    if (out.size() != first) {
+        FlushLastTerm(sum, out);
+    }
+}
+
+// Kronecker substitution: the box [0, max_lhs + max_rhs] of every variable
+// is flattened with the first variable as the most significant digit.
+// Cell index is linear in the degrees, so index(a + b) = index(a) + index(b),
+// and decreasing index is decreasing lex order.
+class KroneckerLayout {
+    public:
+        size_t GetCells() const { return cells_; }
+
+        size_t GetIndex(const Monomial& monomial) const {
+            auto degrees = monomial.GetDegrees();
+            size_t index = 0;
+            for (size_t k = 0; k < degrees.size(); k++) {
+                index += degrees[k] * strides_[k];
+            }
+            return index;
+        }
+
+        Monomial GetMonomial(size_t index) const {
+            degrees_.resize(strides_.size());
+            size_t size = 0;
+            for (size_t k = 0; k < strides_.size(); k++) {
+                degrees_[k] = index / strides_[k];
+                index %= strides_[k];
+                if (degrees_[k] != 0) {
+                    size = k + 1;
+                }
+            }
+            return Monomial(degrees_.begin(), degrees_.begin() + size);
+        }
+
+        // nullopt if the box has more than max_cells cells
+        static std::optional<KroneckerLayout> Make(
+            const std::vector<Monomial::DegreeType>& lhs_max,
+            const std::vector<Monomial::DegreeType>& rhs_max,
+            size_t max_cells) {
+            assert(lhs_max.size() == rhs_max.size());
+            KroneckerLayout layout;
+            layout.strides_.resize(lhs_max.size());
+            for (size_t k = lhs_max.size(); k-- > 0;) {
+                size_t dim = lhs_max[k] + rhs_max[k] + 1;
+                layout.strides_[k] = layout.cells_;
+                if (dim > max_cells / layout.cells_) {
+                    return std::nullopt;
+                }
+                layout.cells_ *= dim;
+            }
+            return layout;
+        }
+
+    private:
+        KroneckerLayout() = default;
+
+        std::vector<size_t> strides_;
+        size_t cells_ = 1;
+        // decoding buffer
+        mutable std::vector<Monomial::DegreeType> degrees_;
+};
+
+// per variable maximal degree, padded with zeros to vars
+template <typename Entry>
+std::vector<Monomial::DegreeType> GetMaxDegrees(
+    const std::vector<Entry>& entries, size_t vars) {
+    std::vector<Monomial::DegreeType> result(vars);
+    for (const auto& entry : entries) {
+        auto degrees = entry->first.GetDegrees();
+        for (size_t k = 0; k < degrees.size(); k++) {
+            result[k] = std::max(result[k], degrees[k]);
+        }
+    }
+    return result;
+}
+
+// non-zero cells of the box, from the leader down,
+// cells are field elements or accumulators
+template <IsComparator Comparator, IsSupportedField Field, typename Cell>
+void ExtractBox(const KroneckerLayout& layout, std::vector<Cell>& box,
+                TermBuffer<Field>& out) {
+    size_t first = out.size();
+    for (size_t index = box.size(); index-- > 0;) {
+        if constexpr (std::is_same_v<Cell, Field>) {
+            if (!box[index].IsZero()) {
+                out.emplace_back(layout.GetMonomial(index),
+                                 std::move(box[index]));
+            }
+        } else if (!box[index].IsEmpty()) {
+            Field value = box[index].Get();
+            if (!value.IsZero()) {
+                out.emplace_back(layout.GetMonomial(index), std::move(value));
+            }
+        }
+    }
+
+    if constexpr (!std::is_same_v<Comparator, LexOrder>) {
+        std::sort(out.begin() + first, out.end(),
+                  [](const auto& lhs_term, const auto& rhs_term) {
+                      return Comparator::IsGreater(lhs_term.first,
+                                                   rhs_term.first);
+                  });
+    }
+}
+
+// Schoolbook product accumulated in an array over the box,
+// every cell is reduced once at the end.
+template <IsComparator Comparator, IsSupportedField Field, typename Entry>
+void MultiplyDense(const std::vector<Entry>& lhs, const std::vector<Entry>& rhs,
+                   const KroneckerLayout& layout, TermBuffer<Field>& out) {
+    std::vector<size_t> rhs_index;
+    rhs_index.reserve(rhs.size());
+    for (const auto& entry : rhs) {
+        rhs_index.push_back(layout.GetIndex(entry->first));
+    }
+
+    std::vector<Accumulator<Field>> box(layout.GetCells());
+    for (const auto& lhs_entry : lhs) {
+        size_t lhs_index = layout.GetIndex(lhs_entry->first);
+        for (size_t j = 0; j < rhs.size(); j++) {
+            box[lhs_index + rhs_index[j]].AddProduct(lhs_entry->second,
+                                                     rhs[j]->second);
+        }
+    }
+    ExtractBox<Comparator>(layout, box, out);
+}
+
+// prime fields small enough for ConvolveModulo
+template <typename Field>
+inline constexpr bool kIsNttFieldV = false;
+
+template <int64_t N>
+inline constexpr bool kIsNttFieldV<Modulo<N>> = N < (int64_t(1) << 31);
+
+// Kronecker substitution turns the product into one univariate product,
+// which is done by number-theoretic transforms.
+template <IsComparator Comparator, int64_t N, typename Entry>
+void MultiplyNtt(const std::vector<Entry>& lhs, const std::vector<Entry>& rhs,
+                 const KroneckerLayout& layout, TermBuffer<Modulo<N>>& out) {
+    auto flatten = [&layout](const std::vector<Entry>& entries) {
+        size_t size = 0;
+        for (const auto& entry : entries) {
+            size = std::max(size, layout.GetIndex(entry->first) + 1);
+        }
+        std::vector<NttValueType> result(size);
+        for (const auto& entry : entries) {
+            result[layout.GetIndex(entry->first)] = entry->second.GetValue();
+        }
+        return result;
+    };
+
+    auto product = ConvolveModulo(flatten(lhs), flatten(rhs), N);
+    std::vector<Modulo<N>> box(product.begin(), product.end());
+    ExtractBox<Comparator>(layout, box, out);
+}
+
+// Dense products below this size stay with the schoolbook loop.
+inline constexpr size_t kNttMinProducts = size_t(1) << 12;
+// NTT is taken when kNttCostFactor * L * log2(L) <= products,
+// L being the transform length.
+inline constexpr size_t kNttCostFactor = 4;
+
+// Picks NTT for large dense products over small prime fields,
+// schoolbook accumulation when supports fill a small box
+// and heap merge for sparse ones.
+template <IsComparator Comparator, IsSupportedField Field, typename Entry>
+void MultiplyEntries(const std::vector<Entry>& lhs_entries,
+                     const std::vector<Entry>& rhs_entries,
+                     TermBuffer<Field>& out) {
+    size_t vars = 0;
+    for (const auto* entries : {&lhs_entries, &rhs_entries}) {
+        for (const auto& entry : *entries) {
+            vars = std::max(vars, entry->first.GetSize());
+        }
+    }
+    auto lhs_max = GetMaxDegrees(lhs_entries, vars);
+    auto rhs_max = GetMaxDegrees(rhs_entries, vars);
+    size_t products = lhs_entries.size() * rhs_entries.size();
+
+    if constexpr (kIsNttFieldV<Field>) {
+        if (products >= kNttMinProducts) {
+            auto layout = KroneckerLayout::Make(lhs_max, rhs_max, kMaxNttSize);
+            if (layout) {
+                size_t size = std::bit_ceil(layout->GetCells());
+                if (kNttCostFactor * size * std::bit_width(size) <= products) {
+                    MultiplyNtt<Comparator>(lhs_entries, rhs_entries, *layout,
+                                            out);
+                    return;
+                }
+            }
+        }
+    }
+
+    auto layout = KroneckerLayout::Make(
+        lhs_max, rhs_max, std::min(kDenseMaxCells, kDenseFillFactor * products));
+    if (layout) {
+        MultiplyDense<Comparator>(lhs_entries, rhs_entries, *layout, out);
+    } else {
+        MultiplyHeap<Comparator>(lhs_entries, rhs_entries, out);
+    }
+}
+
+// Product of two polynomials (anything iterable over sorted entries).
+template <IsComparator Comparator, IsSupportedField Field, typename Range>
+void Multiply(const Range& lhs, const Range& rhs, TermBuffer<Field>& out) {
+    if (lhs.IsZero() || rhs.IsZero()) {
+        return;
+    }
+    MultiplyEntries<Comparator>(CollectEntries(lhs), CollectEntries(rhs), out);
+}
+
+// Sum of two sorted buffers, equal monomials are combined, zeros dropped.
+template <IsComparator Comparator, IsSupportedField Field>
+void MergeTerms(TermBuffer<Field>& lhs, TermBuffer<Field>& rhs,
+                TermBuffer<Field>& out) {
+    out.reserve(out.size() + lhs.size() + rhs.size());
+    auto lhs_it = lhs.begin();
+    auto rhs_it = rhs.begin();
+    while (lhs_it != lhs.end() && rhs_it != rhs.end()) {
+        auto cmp = Comparator::Compare(lhs_it->first, rhs_it->first);
+        if (cmp > 0) {
+            out.push_back(std::move(*lhs_it++));
+        } else if (cmp < 0) {
+            out.push_back(std::move(*rhs_it++));
+        } else {
+            lhs_it->second += rhs_it->second;
+            if (!lhs_it->second.IsZero()) {
+                out.push_back(std::move(*lhs_it));
+            }
+            ++lhs_it;
+            ++rhs_it;
+        }
+    }
+    std::move(lhs_it, lhs.end(), std::back_inserter(out));
+    std::move(rhs_it, rhs.end(), std::back_inserter(out));
+    lhs.clear();
+    rhs.clear();
+}
+
+// State a field keeps per thread, taken from the spawning thread and
+// installed around every job run on a worker; most fields keep none.
+template <IsSupportedField Field>
+class WorkerContext {
+    public:
+        template <typename Job>
+        Job Wrap(Job job) const {
+            return job;
+        }
+};
+
+// RuntimeModulo elements need the modulus of the caller's scope.
+template <>
+class WorkerContext<RuntimeModulo> {
+    public:
+        template <typename Job>
+        auto Wrap(Job job) const {
+            return [capture = capture_, job = std::move(job)] {
+                RuntimeModulo::Scope scope(capture);
+                job();
+            };
+        }
+
+    private:
+        RuntimeModulo::Capture capture_;
+};
+
+// Below this many products threads cost more than they save.
+inline constexpr size_t kParallelMinProducts = size_t(1) << 14;
+
+// The longer factor is cut into one chunk per thread, every thread
+// multiplies its chunk by the other factor into its own buffer,
+// then the buffers are merged pairwise, each round in parallel.
+// The inputs are only read, and every worker writes only its own
+// partial product or merged buffer, so workers share no mutable state.
+template <IsComparator Comparator, IsSupportedField Field, typename Range>
+void MultiplyParallel(const Range& lhs, const Range& rhs, size_t threads,
+                      TermBuffer<Field>& out) {
+    if (lhs.IsZero() || rhs.IsZero()) {
+        return;
+    }
+
+    auto lhs_entries = CollectEntries(lhs);
+    auto rhs_entries = CollectEntries(rhs);
+    if (lhs_entries.size() < rhs_entries.size()) {
+        std::swap(lhs_entries, rhs_entries);
+    }
+
+    size_t products = lhs_entries.size() * rhs_entries.size();
+    threads = std::min({threads, lhs_entries.size(),
+                        std::max<size_t>(1, products / kParallelMinProducts)});
+    if (threads <= 1) {
+        MultiplyEntries<Comparator>(lhs_entries, rhs_entries, out);
+        return;
+    }
+
+    WorkerContext<Field> context;
+    std::vector<TermBuffer<Field>> buffers(threads);
+    {
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+        for (size_t t = 0; t < threads; t++) {
+            size_t begin = lhs_entries.size() * t / threads;
+            size_t end = lhs_entries.size() * (t + 1) / threads;
+            workers.emplace_back(context.Wrap([&, begin, end, t] {
+                decltype(lhs_entries) chunk(lhs_entries.begin() + begin,
+                                            lhs_entries.begin() + end);
+                MultiplyEntries<Comparator>(chunk, rhs_entries, buffers[t]);
+            }));
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    while (buffers.size() > 1) {
+        std::vector<TermBuffer<Field>> merged((buffers.size() + 1) / 2);
+        std::vector<std::thread> workers;
+        for (size_t i = 0; i + 1 < buffers.size(); i += 2) {
+            workers.emplace_back(context.Wrap([&, i] {
+                MergeTerms<Comparator>(buffers[i], buffers[i + 1],
+                                       merged[i / 2]);
+            }));
+        }
+        if (buffers.size() % 2 == 1) {
+            merged.back() = std::move(buffers.back());
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        buffers = std::move(merged);
+    }
+
+    if (out.empty()) {
+        out = std::move(buffers[0]);
+    } else {
+        std::move(buffers[0].begin(), buffers[0].end(),
+                  std::back_inserter(out));
+    }
+}
+}  // namespace Groebner::Details
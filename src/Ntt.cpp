@@ -0,0 +1,179 @@
+#include "Ntt.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+
+namespace Groebner::Details {
+namespace {
+    struct NttPrime {
+            NttValueType modulus;
+            NttValueType root;
+    };
+
+    // p = c * 2^k + 1 with primitive root 3, sorted by decreasing p
+    constexpr std::array<NttPrime, 3> kNttPrimes = {
+        {{998244353, 3}, {469762049, 3}, {167772161, 3}}};
+
+    uint64_t PowMod(uint64_t base, uint64_t exp, uint64_t modulus) {
+        uint64_t result = 1;
+        base %= modulus;
+        for (; exp > 0; exp >>= 1) {
+            if (exp & 1) {
+                result = result * base % modulus;
+            }
+            base = base * base % modulus;
+        }
+        return result;
+    }
+
+    uint64_t InverseMod(uint64_t value, uint64_t prime) {
+        return PowMod(value, prime - 2, prime);
+    }
+
+    // in-place iterative transform, size is a power of two
+    void Transform(std::vector<NttValueType>& values, const NttPrime& prime,
+                   bool is_inverse) {
+        const uint64_t modulus = prime.modulus;
+        const size_t size = values.size();
+
+        for (size_t i = 1, j = 0; i < size; i++) {
+            size_t bit = size >> 1;
+            for (; j & bit; bit >>= 1) {
+                j ^= bit;
+            }
+            j ^= bit;
+            if (i < j) {
+                std::swap(values[i], values[j]);
+            }
+        }
+
+        std::vector<NttValueType> roots;
+        for (size_t len = 2; len <= size; len <<= 1) {
+            uint64_t step = PowMod(prime.root, (modulus - 1) / len, modulus);
+            if (is_inverse) {
+                step = InverseMod(step, modulus);
+            }
+            size_t half = len / 2;
+            roots.resize(half);
+            roots[0] = 1;
+            for (size_t j = 1; j < half; j++) {
+                roots[j] = roots[j - 1] * step % modulus;
+            }
+
+            for (size_t i = 0; i < size; i += len) {
+                for (size_t j = 0; j < half; j++) {
+                    uint64_t u = values[i + j];
+                    uint64_t v = values[i + j + half] * uint64_t(roots[j]) %
+                                 modulus;
+                    values[i + j] = u + v < modulus ? u + v : u + v - modulus;
+                    values[i + j + half] = u >= v ? u - v : u + modulus - v;
+                }
+            }
+        }
+
+        if (is_inverse) {
+            uint64_t size_inverse = InverseMod(size, modulus);
+            for (auto& value : values) {
+                value = value * size_inverse % modulus;
+            }
+        }
+    }
+
+    std::vector<NttValueType> ConvolveWithPrime(
+        const std::vector<NttValueType>& lhs,
+        const std::vector<NttValueType>& rhs, const NttPrime& prime,
+        size_t size) {
+        std::vector<NttValueType> lhs_values(size), rhs_values(size);
+        for (size_t i = 0; i < lhs.size(); i++) {
+            lhs_values[i] = lhs[i] % prime.modulus;
+        }
+        for (size_t i = 0; i < rhs.size(); i++) {
+            rhs_values[i] = rhs[i] % prime.modulus;
+        }
+
+        Transform(lhs_values, prime, false);
+        Transform(rhs_values, prime, false);
+        for (size_t i = 0; i < size; i++) {
+            lhs_values[i] = uint64_t(lhs_values[i]) * rhs_values[i] %
+                            prime.modulus;
+        }
+        Transform(lhs_values, prime, true);
+        return lhs_values;
+    }
+
+    // how many primes are needed for the product to exceed every
+    // coefficient of the exact convolution
+    size_t CountPrimes(size_t terms, NttValueType modulus) {
+        using Wide = unsigned __int128;
+        Wide bound = Wide(terms) * (modulus - 1) * (modulus - 1);
+        Wide product = 1;
+        for (size_t count = 1; count <= kNttPrimes.size(); count++) {
+            product *= kNttPrimes[count - 1].modulus;
+            if (bound < product) {
+                return count;
+            }
+        }
+        assert(false && "Convolution is too long for CRT");
+        return kNttPrimes.size();
+    }
+}  // namespace
+
+std::vector<NttValueType> ConvolveModulo(const std::vector<NttValueType>& lhs,
+                                         const std::vector<NttValueType>& rhs,
+                                         NttValueType modulus) {
+    if (lhs.empty() || rhs.empty()) {
+        return {};
+    }
+
+    size_t result_size = lhs.size() + rhs.size() - 1;
+    size_t size = std::bit_ceil(result_size);
+    assert(size <= kMaxNttSize && "Convolution is too long for NTT");
+
+    // transforms modulo the NTT prime itself need no CRT
+    for (const auto& prime : kNttPrimes) {
+        if (prime.modulus == modulus) {
+            auto result = ConvolveWithPrime(lhs, rhs, prime, size);
+            result.resize(result_size);
+            return result;
+        }
+    }
+
+    size_t primes = CountPrimes(std::min(lhs.size(), rhs.size()), modulus);
+    std::array<std::vector<NttValueType>, kNttPrimes.size()> residues;
+    for (size_t k = 0; k < primes; k++) {
+        residues[k] = ConvolveWithPrime(lhs, rhs, kNttPrimes[k], size);
+    }
+
+    // Garner: value = x_0 + x_1 m_0 + x_2 m_0 m_1 with 0 <= x_k < m_k
+    std::array<std::array<uint64_t, kNttPrimes.size()>, kNttPrimes.size()>
+        inverses{};
+    for (size_t k = 0; k < primes; k++) {
+        for (size_t j = 0; j < k; j++) {
+            inverses[j][k] = InverseMod(kNttPrimes[j].modulus,
+                                        kNttPrimes[k].modulus);
+        }
+    }
+
+    std::vector<NttValueType> result(result_size);
+    for (size_t i = 0; i < result_size; i++) {
+        std::array<uint64_t, kNttPrimes.size()> digits{};
+        uint64_t value = 0;
+        uint64_t scale = 1;
+        for (size_t k = 0; k < primes; k++) {
+            uint64_t prime = kNttPrimes[k].modulus;
+            uint64_t digit = residues[k][i];
+            for (size_t j = 0; j < k; j++) {
+                digit = (digit + prime - digits[j] % prime) % prime *
+                        inverses[j][k] % prime;
+            }
+            digits[k] = digit;
+            value = (value + digit % modulus * scale) % modulus;
+            scale = scale * (kNttPrimes[k].modulus % modulus) % modulus;
+        }
+        result[i] = value;
+    }
+    return result;
+}
+}  // namespace Groebner::Details
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cinttypes>
+#include <cstddef>
+#include <vector>
+
+namespace Groebner::Details {
+using NttValueType = uint32_t;
+
+// longest cyclic convolution the transform primes support (2^23 | p - 1)
+inline constexpr size_t kMaxNttSize = size_t(1) << 23;
+
+// Coefficients of lhs * rhs modulo modulus, all values in [0, modulus).
+// Exact products are recovered by CRT over up to three NTT primes,
+// which is enough for modulus < 2^31 and sizes up to kMaxNttSize.
+std::vector<NttValueType> ConvolveModulo(const std::vector<NttValueType>& lhs,
+                                         const std::vector<NttValueType>& rhs,
+                                         NttValueType modulus);
+}  // namespace Groebner::Details
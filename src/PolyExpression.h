@@ -0,0 +1,203 @@
+#pragma once
+
+#include "Polynomial.h"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace Groebner {
+namespace Details {
+    template <IsSupportedField Field, IsComparator Comparator>
+    struct ScaledPoly {
+            const Polynomial<Field, Comparator>* poly = nullptr;
+            Term<Field> scale;
+    };
+}  // namespace Details
+
+// Lazy sum of scaled polynomials, c_1 m_1 p_1 + ... + c_n m_n p_n.
+// Operators only collect the operands, the sum is computed by one k-way
+// merge when the expression is converted to a Polynomial, so chains like
+// Lazy(p) * t1 - Lazy(q) * t2 + Lazy(r) build no intermediate polynomials.
+// The expression keeps pointers: operands must outlive its evaluation.
+template <IsSupportedField Field, IsComparator Comparator, size_t Size>
+class LinearCombination {
+    private:
+        using LocalPoly = Polynomial<Field, Comparator>;
+        using LocalTerm = Term<Field>;
+        using Piece = Details::ScaledPoly<Field, Comparator>;
+
+    public:
+        explicit LinearCombination(const LocalPoly& poly)
+            requires(Size == 1)
+            : pieces_{Piece{&poly, LocalTerm{1, Monomial()}}} {}
+
+        LinearCombination operator*(const LocalTerm& term) const& {
+            LinearCombination result(*this);
+            result *= term;
+            return result;
+        }
+        LinearCombination operator*(const LocalTerm& term) && {
+            *this *= term;
+            return std::move(*this);
+        }
+
+        LinearCombination operator-() const {
+            LinearCombination result(*this);
+            for (auto& piece : result.pieces_) {
+                piece.scale.coef = -piece.scale.coef;
+            }
+            return result;
+        }
+
+        template <size_t OtherSize>
+        LinearCombination<Field, Comparator, Size + OtherSize> operator+(
+            const LinearCombination<Field, Comparator, OtherSize>& other)
+            const {
+            return Concat(other, false);
+        }
+
+        template <size_t OtherSize>
+        LinearCombination<Field, Comparator, Size + OtherSize> operator-(
+            const LinearCombination<Field, Comparator, OtherSize>& other)
+            const {
+            return Concat(other, true);
+        }
+
+        LinearCombination<Field, Comparator, Size + 1> operator+(
+            const LocalPoly& poly) const {
+            return *this + LinearCombination<Field, Comparator, 1>(poly);
+        }
+
+        LinearCombination<Field, Comparator, Size + 1> operator-(
+            const LocalPoly& poly) const {
+            return *this - LinearCombination<Field, Comparator, 1>(poly);
+        }
+
+        // The result is allocated from the resource of alloc.
+        LocalPoly Evaluate(
+            const typename LocalPoly::allocator_type& alloc = {}) const {
+            Details::TermBuffer<Field> buffer;
+            Merge(buffer);
+            LocalPoly result(alloc);
+            result.AssignSorted(buffer);
+            return result;
+        }
+
+        operator LocalPoly() const { return Evaluate(); }
+
+        // safe when destination is one of the operands
+        void EvaluateInto(LocalPoly& destination) const {
+            Details::TermBuffer<Field> buffer;
+            Merge(buffer);
+            destination.AssignSorted(buffer);
+        }
+
+    private:
+        template <IsSupportedField, IsComparator, size_t>
+        friend class LinearCombination;
+
+        explicit LinearCombination(std::array<Piece, Size>&& pieces)
+            : pieces_(std::move(pieces)) {}
+
+        LinearCombination& operator*=(const LocalTerm& term) {
+            for (auto& piece : pieces_) {
+                piece.scale.coef *= term.coef;
+                piece.scale.degree += term.degree;
+            }
+            return *this;
+        }
+
+        template <size_t OtherSize>
+        LinearCombination<Field, Comparator, Size + OtherSize> Concat(
+            const LinearCombination<Field, Comparator, OtherSize>& other,
+            bool is_negated) const {
+            std::array<Piece, Size + OtherSize> pieces;
+            std::copy(pieces_.begin(), pieces_.end(), pieces.begin());
+            std::copy(other.pieces_.begin(), other.pieces_.end(),
+                      pieces.begin() + Size);
+            if (is_negated) {
+                for (size_t i = Size; i < Size + OtherSize; i++) {
+                    pieces[i].scale.coef = -pieces[i].scale.coef;
+                }
+            }
+            return LinearCombination<Field, Comparator, Size + OtherSize>(
+                std::move(pieces));
+        }
+
+        // Every piece is a stream of terms in decreasing order, since
+        // orders are multiplicative. Streams are merged through a max-heap,
+        // so equal monomials come out one after another and are summed
+        // in one accumulator.
+        void Merge(Details::TermBuffer<Field>& out) const {
+            struct Stream {
+                    typename LocalPoly::ConstIterator current;
+                    typename LocalPoly::ConstIterator end;
+                    const LocalTerm* scale;
+                    Monomial product;
+
+                    void Load() {
+                        product = current->first;
+                        product += scale->degree;
+                    }
+            };
+
+            std::vector<Stream> streams;
+            streams.reserve(Size);
+            size_t total = 0;
+            for (const auto& piece : pieces_) {
+                if (!piece.poly->IsZero() && !piece.scale.coef.IsZero()) {
+                    streams.push_back({piece.poly->begin(), piece.poly->end(),
+                                       &piece.scale, Monomial()});
+                    streams.back().Load();
+                    total += piece.poly->GetSize();
+                }
+            }
+            out.reserve(total);
+
+            std::vector<size_t> heap(streams.size());
+            for (size_t i = 0; i < heap.size(); i++) {
+                heap[i] = i;
+            }
+            auto is_less = [&streams](size_t a, size_t b) {
+                return Comparator::IsLess(streams[a].product,
+                                          streams[b].product);
+            };
+            std::make_heap(heap.begin(), heap.end(), is_less);
+
+            Details::Accumulator<Field> sum;
+            while (!heap.empty()) {
+                std::pop_heap(heap.begin(), heap.end(), is_less);
+                auto& stream = streams[heap.back()];
+
+                if (out.empty() || out.back().first != stream.product) {
+                    if (!out.empty()) {
+                        Details::FlushLastTerm(sum, out);
+                    }
+                    out.emplace_back(stream.product, Field());
+                }
+                sum.AddProduct(stream.current->second, stream.scale->coef);
+
+                if (++stream.current != stream.end) {
+                    stream.Load();
+                    std::push_heap(heap.begin(), heap.end(), is_less);
+                } else {
+                    heap.pop_back();
+                }
+            }
+            if (!out.empty()) {
+                Details::FlushLastTerm(sum, out);
+            }
+        }
+
+        std::array<Piece, Size> pieces_;
+};
+
+// Starts a lazy expression, see LinearCombination.
+template <IsSupportedField Field, IsComparator Comparator>
+LinearCombination<Field, Comparator, 1> Lazy(
+    const Polynomial<Field, Comparator>& poly) {
+    return LinearCombination<Field, Comparator, 1>(poly);
+}
+
+}  // namespace Groebner
@@ -5,6 +5,8 @@
 #include "IteratorFwd.h"
 #include "Polynomial.h"
 
+#include <memory_resource>
+
 namespace Groebner {
 
 template <IsSupportedField Field, IsComparator Comparator>
@@ -13,10 +15,50 @@ class PolySystem {
         using LocalPolynomial = Polynomial<Field, Comparator>;
 
     public:
+        // polynomials and their terms are allocated from the given resource
+        using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
         PolySystem() = default;
+        explicit PolySystem(const allocator_type& alloc)
+            : polynomials_(alloc) {}
+
+        PolySystem(const PolySystem& other) = default;
+        PolySystem(PolySystem&& other) = default;
+        PolySystem(const PolySystem& other, const allocator_type& alloc)
+            : polynomials_(other.polynomials_, alloc) {}
+        PolySystem(PolySystem&& other, const allocator_type& alloc)
+            : polynomials_(std::move(other.polynomials_), alloc) {}
+
+        PolySystem& operator=(const PolySystem& other) = default;
+        PolySystem& operator=(PolySystem&& other) = default;
+
+        // Conversion to this order, every polynomial is re-sorted once
+        // (and keeps its nodes when moved from the same resource).
+        template <IsComparator Other>
+        requires(!std::is_same_v<Other, Comparator>) explicit PolySystem(
+            const PolySystem<Field, Other>& other,
+            const allocator_type& alloc = {})
+            : polynomials_(alloc) {
+            polynomials_.reserve(other.GetSize());
+            for (size_t i = 0; i < other.GetSize(); i++) {
+                polynomials_.emplace_back(other[i]);
+            }
+        }
+
+        template <IsComparator Other>
+        requires(!std::is_same_v<Other, Comparator>) explicit PolySystem(
+            PolySystem<Field, Other>&& other, const allocator_type& alloc = {})
+            : polynomials_(alloc) {
+            polynomials_.reserve(other.GetSize());
+            for (size_t i = 0; i < other.GetSize(); i++) {
+                polynomials_.emplace_back(std::move(other[i]));
+            }
+            other.polynomials_.clear();
+        }
 
-        // TODO add constructors for other Comparator
-        explicit PolySystem(std::vector<LocalPolynomial>&& polys) {
+        explicit PolySystem(std::vector<LocalPolynomial>&& polys,
+                            const allocator_type& alloc = {})
+            : polynomials_(alloc) {
             polynomials_.reserve(polys.size());
             for (auto& poly : polys) {
                 if (!poly.IsZero()) {
@@ -25,7 +67,9 @@ class PolySystem {
             }
         }
 
-        PolySystem(std::initializer_list<LocalPolynomial> polys) {
+        PolySystem(std::initializer_list<LocalPolynomial> polys,
+                   const allocator_type& alloc = {})
+            : polynomials_(alloc) {
             polynomials_.reserve(polys.size());
             for (auto& poly : polys) {
                 if (!poly.IsZero()) {
@@ -35,7 +79,8 @@ class PolySystem {
         }
 
         template <Details::IsIterator It>
-        PolySystem(It begin, It end) {
+        PolySystem(It begin, It end, const allocator_type& alloc = {})
+            : polynomials_(alloc) {
             polynomials_.reserve(std::distance(begin, end));
             for (auto it = begin; it != end; it++) {
                 if (!(it->IsZero())) {
@@ -44,6 +89,13 @@ class PolySystem {
             }
         }
 
+        allocator_type get_allocator() const {
+            return polynomials_.get_allocator();
+        }
+        std::pmr::memory_resource* GetResource() const {
+            return polynomials_.get_allocator().resource();
+        }
+
         size_t GetSize() const { return polynomials_.size(); }
         bool IsEmpty() const { return GetSize() == 0; }
 
@@ -94,6 +146,8 @@ class PolySystem {
 
         // TODO add comparison operator (and one for system with different comparator
     friend class GroebnerAlgorithm;
+    template <IsSupportedField, IsComparator>
+    friend class PolySystem;
     private:
         void Reduce() {
             size_t sz = polynomials_.size();
@@ -107,6 +161,6 @@ class PolySystem {
             }
         }
 
-        std::vector<LocalPolynomial> polynomials_;
+        std::pmr::vector<LocalPolynomial> polynomials_;
 };
 }  // namespace Groebner
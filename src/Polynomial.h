@@ -2,9 +2,15 @@
 
 #include "ComparatorFwd.h"
 #include "FieldFwd.h"
+#include "Multiplication.h"
 
 #include <algorithm>
+#include <iterator>
 #include <map>
+#include <memory_resource>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace Groebner {
 
@@ -25,63 +31,158 @@ struct Term {
             return *this;
         }
 
-        Term<Field> operator/(const Term& other) const {
+        Term<Field> operator/(const Term& other) const& {
             Term temp(*this);
             temp /= other;
             return temp;
         }
+        Term<Field> operator/(const Term& other) && {
+            *this /= other;
+            return std::move(*this);
+        }
 };
 
 using RationalTerm = Term<Rational>;
+using BigRationalTerm = Term<BigRational>;
+using Gf2Term = Term<Gf2>;
+
+template <int64_t P, size_t K>
+using GaloisFieldTerm = Term<GaloisField<P, K>>;
 template <int64_t N>
 requires IsPrime<N> using ModuloTerm = Term<Modulo<N>>;
 
+template <IsSupportedField Field, IsComparator Comparator, size_t Size>
+class LinearCombination;
+
 template <IsSupportedField Field, IsComparator Comparator = LexOrder>
 class Polynomial {
     private:
         using LocalTerm = Term<Field>;
         using LocalPoly = Polynomial<Field, Comparator>;
 
+        struct Compare {
+                bool operator()(const Monomial& lhs,
+                                const Monomial& rhs) const {
+                    return Comparator::IsGreater(lhs, rhs);
+                }
+        };
+
+        using PolyTable = std::pmr::map<Monomial, Field, Compare>;
+
+        // summary of the terms, every value is filled lazily on its own
+        // and all are dropped on every change, so leader-only queries never
+        // scan the terms (the leader itself is the first node of the map)
+        struct Metadata {
+                Monomial::MaskType leader_mask = 0;
+                Monomial::DegreeType total_degree = 0;
+                bool has_leader_mask = false;
+                bool has_total_degree = false;
+
+                Metadata() = default;
+                Metadata(const Metadata& other) = default;
+                Metadata(Metadata&& other) noexcept : Metadata(other) {
+                    other.Clear();
+                }
+                Metadata& operator=(const Metadata& other) = default;
+                Metadata& operator=(Metadata&& other) noexcept {
+                    *this = other;
+                    other.Clear();
+                    return *this;
+                }
+
+                void Clear() { has_leader_mask = has_total_degree = false; }
+        };
+
     public:
+        // terms are allocated from the given memory resource,
+        // results of arithmetic operators use the resource of the left side
+        using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
         Polynomial() = default;
+        explicit Polynomial(const allocator_type& alloc) : monomials_(alloc) {}
+
+        Polynomial(const Polynomial& other) = default;
+        Polynomial(Polynomial&& other) = default;
+        Polynomial(const Polynomial& other, const allocator_type& alloc)
+            : monomials_(other.monomials_, alloc),
+              metadata_(other.metadata_) {}
+        Polynomial(Polynomial&& other, const allocator_type& alloc)
+            : monomials_(std::move(other.monomials_), alloc),
+              metadata_(std::move(other.metadata_)) {}
+
+        Polynomial& operator=(const Polynomial& other) = default;
+        Polynomial& operator=(Polynomial&& other) = default;
+
+        // Conversion to this order: terms are already combined,
+        // so they are sorted once and appended without lookups.
+        template <IsComparator Other>
+        requires(!std::is_same_v<Other, Comparator>) explicit Polynomial(
+            const Polynomial<Field, Other>& other,
+            const allocator_type& alloc = {})
+            : monomials_(alloc) {
+            AssignDistinct(other.begin(), other.end());
+        }
 
-        // TODO add constructor from Polynomial with different comparator
-        explicit Polynomial(std::vector<LocalTerm>&& monomials) {
-            for (auto& [coef, degree] : monomials) {
-                auto it = monomials_.find(degree);
-                if (it == monomials_.end()) {
-                    monomials_[std::move(degree)] = std::move(coef);
-                } else {
-                    it->second += coef;
+        // map nodes are moved over when both sides share the resource
+        template <IsComparator Other>
+        requires(!std::is_same_v<Other, Comparator>) explicit Polynomial(
+            Polynomial<Field, Other>&& other, const allocator_type& alloc = {})
+            : monomials_(alloc) {
+            using OtherTable = typename Polynomial<Field, Other>::PolyTable;
+            using NodeType = typename PolyTable::node_type;
+            if constexpr (std::is_same_v<NodeType,
+                                         typename OtherTable::node_type>) {
+                if (get_allocator() == other.get_allocator()) {
+                    std::vector<NodeType> nodes;
+                    nodes.reserve(other.GetSize());
+                    while (!other.IsZero()) {
+                        nodes.push_back(other.monomials_.extract(
+                            other.monomials_.begin()));
+                    }
+                    other.Invalidate();
+
+                    std::sort(nodes.begin(), nodes.end(),
+                              [](const NodeType& lhs, const NodeType& rhs) {
+                                  return Comparator::IsGreater(lhs.key(),
+                                                               rhs.key());
+                              });
+                    for (auto& node : nodes) {
+                        monomials_.insert(monomials_.end(), std::move(node));
+                    }
+                    return;
                 }
             }
-            Reduce();
+            AssignDistinct(other.begin(), other.end());
         }
 
-        Polynomial(std::initializer_list<LocalTerm> monomials) {
-            for (auto& [coef, degree] : monomials) {
-                auto it = monomials_.find(degree);
-                if (it == monomials_.end()) {
-                    monomials_[degree] = coef;
-                } else {
-                    it->second += coef;
-                }
-            }
-            Reduce();
+        explicit Polynomial(std::vector<LocalTerm>&& monomials,
+                            const allocator_type& alloc = {})
+            : monomials_(alloc) {
+            AssignUnsorted<true>(monomials.begin(), monomials.end());
+        }
+
+        Polynomial(std::initializer_list<LocalTerm> monomials,
+                   const allocator_type& alloc = {})
+            : monomials_(alloc) {
+            AssignUnsorted<false>(monomials.begin(), monomials.end());
         }
 
         template <Details::IsIterator It>
-        Polynomial(It begin, It end) {
-            for (auto cur = begin; cur != end; cur++) {
-                auto& [coef, degree] = *cur;
-                auto it = monomials_.find(degree);
-                if (it == monomials_.end()) {
-                    monomials_[degree] = coef;
-                } else {
-                    it->second += coef;
-                }
+        Polynomial(It begin, It end, const allocator_type& alloc = {})
+            : monomials_(alloc) {
+            if constexpr (std::forward_iterator<It>) {
+                AssignUnsorted<false>(begin, end);
+            } else {
+                std::vector<LocalTerm> terms(begin, end);
+                AssignUnsorted<true>(terms.begin(), terms.end());
             }
-            Reduce();
+        }
+
+        allocator_type get_allocator() const {
+            return monomials_.get_allocator();
+        }
+        std::pmr::memory_resource* GetResource() const {
+            return monomials_.get_allocator().resource();
         }
 
         size_t GetSize() const { return monomials_.size(); }
@@ -94,7 +195,80 @@ class Polynomial {
             auto [degree, coef] = *(monomials_.begin());
             return LocalTerm(coef, degree);
         }
-        // TODO add iterators
+        // terms from the leader down, as (const Monomial&, const Field&)
+        using ConstIterator = typename PolyTable::const_iterator;
+
+        ConstIterator begin() const { return monomials_.begin(); }
+        ConstIterator end() const { return monomials_.end(); }
+
+        // borrowed leader, valid until the polynomial changes
+        const Monomial& GetLeaderDegree() const {
+            assert(!IsZero() && "Zero polynomial has no leader");
+            return monomials_.begin()->first;
+        }
+        const Field& GetLeaderCoef() const {
+            assert(!IsZero() && "Zero polynomial has no leader");
+            return monomials_.begin()->second;
+        }
+
+        // O(variables) when not cached, the terms are not scanned
+        Monomial::MaskType GetLeaderMask() const {
+            if (!metadata_.has_leader_mask) {
+                metadata_.leader_mask =
+                    IsZero() ? 0 : GetLeaderDegree().GetDivisibilityMask();
+                metadata_.has_leader_mask = true;
+            }
+            return metadata_.leader_mask;
+        }
+        // maximal sum degree of the terms, 0 for zero polynomial,
+        // O(terms) when not cached
+        Monomial::DegreeType GetTotalDegree() const {
+            if (!metadata_.has_total_degree) {
+                metadata_.total_degree = 0;
+                for (const auto& [degree, coef] : monomials_) {
+                    metadata_.total_degree =
+                        std::max(metadata_.total_degree, degree.GetSumDegree());
+                }
+                metadata_.has_total_degree = true;
+            }
+            return metadata_.total_degree;
+        }
+
+        // leader of other divides the leader of this, leader masks and
+        // sum degrees reject most candidates before the degrees are compared
+        bool IsLeaderDivisibleBy(const LocalPoly& other) const {
+            const auto& degree = GetLeaderDegree();
+            const auto& other_degree = other.GetLeaderDegree();
+            if ((other.GetLeaderMask() & ~GetLeaderMask()) != 0 ||
+                other_degree.GetSumDegree() > degree.GetSumDegree()) {
+                return false;
+            }
+            return degree.IsDivisible(other_degree);
+        }
+
+        // moves the leader into other, reusing its node when possible
+        void MoveLeaderTo(LocalPoly& other) {
+            assert(!IsZero() && "Zero polynomial has no leader");
+            Invalidate();
+            other.Invalidate();
+            if (get_allocator() != other.get_allocator()) {
+                auto it = monomials_.begin();
+                other += LocalTerm(it->second, it->first);
+                monomials_.erase(it);
+                return;
+            }
+
+            auto result =
+                other.monomials_.insert(monomials_.extract(monomials_.begin()));
+            if (!result.inserted) {
+                result.position->second += result.node.mapped();
+                if (result.position->second.IsZero()) {
+                    other.monomials_.erase(result.position);
+                }
+            }
+        }
+
+        // linear in i, prefer iterators for traversal
         LocalTerm GetAt(size_t i) const {
             if (i == 0 && IsZero()) {
                 return {0, 0};
@@ -106,131 +280,390 @@ class Polynomial {
         }
 
         void ReduceByLeaderCoef() {
-            auto leader_coef = GetLeader().coef;
+            ReduceByLeaderCoef(Field(1) / GetLeaderCoef());
+        }
+
+        // leader_inverse is 1 / GetLeaderCoef(), computed by the caller
+        void ReduceByLeaderCoef(const Field& leader_inverse) {
+            ScaleCoefs(leader_inverse);
+        }
+
+        // every coefficient times a non-zero factor, the order is kept
+        void ScaleCoefs(const Field& factor) {
+            assert(!factor.IsZero() && "Scaling by zero");
             for (auto& [degree, coef] : monomials_) {
-                coef /= leader_coef;
+                coef *= factor;
             }
         }
 
         LocalPoly& operator+=(const LocalPoly& other) {
+            if (&other == this) {
+                return *this *= LocalTerm{2, {}};
+            }
+            for (const auto& [degree, coef] : other.monomials_) {
+                AddTerm(degree, coef);
+            }
+            return *this;
+        }
+
+        // nodes of other are moved over where there is no such monomial yet
+        LocalPoly& operator+=(LocalPoly&& other) {
+            if (&other == this || get_allocator() != other.get_allocator()) {
+                return *this += std::as_const(other);
+            }
+            Invalidate();
+            monomials_.merge(other.monomials_);
             for (auto& [degree, coef] : other.monomials_) {
-                monomials_[degree] += coef;
+                AddTerm(degree, std::move(coef));
             }
-            Reduce();
+            other.monomials_.clear();
+            other.Invalidate();
             return *this;
         }
 
         LocalPoly& operator-=(const LocalPoly& other) {
-            for (auto& [degree, coef] : other.monomials_) {
-                monomials_[degree] -= coef;
+            if (&other == this) {
+                monomials_.clear();
+                Invalidate();
+                return *this;
+            }
+            for (const auto& [degree, coef] : other.monomials_) {
+                AddTerm(degree, -coef);
             }
-            Reduce();
             return *this;
         }
 
-        LocalPoly& operator*=(const LocalPoly& other) {
-            PolyTable result;
-            for (auto& [rhs_degree, rhs_coef] : other.monomials_) {
-                for (auto& [lhs_degree, lhs_coef] : monomials_) {
-                    result[rhs_degree + lhs_degree] += (rhs_coef * lhs_coef);
-                }
+        LocalPoly& operator-=(LocalPoly&& other) {
+            if (&other == this) {
+                return *this -= std::as_const(other);
             }
-            monomials_ = std::move(result);
-            Reduce();
+            other.Negate();
+            return *this += std::move(other);
+        }
+
+        LocalPoly& operator*=(const LocalPoly& other) {
+            Details::TermBuffer<Field> product;
+            Details::Multiply<Comparator>(*this, other, product);
+            AssignSorted(product);
             return *this;
         }
 
-        LocalPoly operator+(const LocalPoly& other) const {
-            Polynomial temp(*this);
+        // product computed by several threads, 0 means one per core;
+        // small products fall back to a single thread
+        LocalPoly MultiplyParallel(const LocalPoly& other,
+                                   size_t threads = 0) const {
+            if (threads == 0) {
+                threads = std::max(1U, std::thread::hardware_concurrency());
+            }
+            Details::TermBuffer<Field> product;
+            Details::MultiplyParallel<Comparator>(*this, other, threads,
+                                                  product);
+            LocalPoly result(get_allocator());
+            result.AssignSorted(product);
+            return result;
+        }
+
+        // Binary operators reuse the storage of an rvalue operand
+        // when it shares the resource of the left side.
+        LocalPoly operator+(const LocalPoly& other) const& {
+            LocalPoly temp(*this, get_allocator());
             temp += other;
             return temp;
         }
+        LocalPoly operator+(const LocalPoly& other) && {
+            *this += other;
+            return std::move(*this);
+        }
+        friend LocalPoly operator+(const LocalPoly& lhs, LocalPoly&& rhs) {
+            if (lhs.get_allocator() != rhs.get_allocator()) {
+                return lhs + std::as_const(rhs);
+            }
+            rhs += lhs;
+            return std::move(rhs);
+        }
+        friend LocalPoly operator+(LocalPoly&& lhs, LocalPoly&& rhs) {
+            lhs += std::move(rhs);
+            return std::move(lhs);
+        }
 
-        LocalPoly operator-(const LocalPoly& other) const {
-            Polynomial temp(*this);
+        LocalPoly operator-(const LocalPoly& other) const& {
+            LocalPoly temp(*this, get_allocator());
             temp -= other;
             return temp;
         }
+        LocalPoly operator-(const LocalPoly& other) && {
+            *this -= other;
+            return std::move(*this);
+        }
+        friend LocalPoly operator-(const LocalPoly& lhs, LocalPoly&& rhs) {
+            if (lhs.get_allocator() != rhs.get_allocator()) {
+                return lhs - std::as_const(rhs);
+            }
+            rhs.Negate();
+            rhs += lhs;
+            return std::move(rhs);
+        }
+        friend LocalPoly operator-(LocalPoly&& lhs, LocalPoly&& rhs) {
+            lhs -= std::move(rhs);
+            return std::move(lhs);
+        }
 
         LocalPoly operator*(const LocalPoly& other) const {
-            LocalPoly temp(*this);
-            temp *= other;
+            Details::TermBuffer<Field> product;
+            Details::Multiply<Comparator>(*this, other, product);
+            LocalPoly result(get_allocator());
+            result.AssignSorted(product);
+            return result;
+        }
+
+        LocalPoly operator-() const& {
+            LocalPoly temp(*this, get_allocator());
+            temp.Negate();
             return temp;
         }
+        LocalPoly operator-() && {
+            Negate();
+            return std::move(*this);
+        }
 
         LocalPoly& operator+=(const LocalTerm& term) {
-            monomials_[term.degree] += term.coef;
-            if (monomials_[term.degree].IsZero()) {
-                monomials_.erase(term.degree);
-            }
+            AddTerm(term.degree, term.coef);
+            return *this;
+        }
+        LocalPoly& operator+=(LocalTerm&& term) {
+            AddTerm(std::move(term.degree), std::move(term.coef));
             return *this;
         }
 
         LocalPoly& operator-=(const LocalTerm& term) {
-            monomials_[term.degree] -= term.coef;
-            if (monomials_[term.degree].IsZero()) {
-                monomials_.erase(term.degree);
-            }
+            AddTerm(term.degree, -term.coef);
+            return *this;
+        }
+        LocalPoly& operator-=(LocalTerm&& term) {
+            AddTerm(std::move(term.degree), -term.coef);
             return *this;
         }
 
+        // Orders are multiplicative, so the order of terms is kept
+        // and every node is updated and relinked in place.
         LocalPoly& operator*=(const LocalTerm& term) {
-            PolyTable result;
-            for (auto& [degree, coef] : monomials_) {
-                result[degree + term.degree] += (coef * term.coef);
+            Invalidate();
+            if (term.coef.IsZero()) {
+                monomials_.clear();
+                return *this;
+            }
+
+            PolyTable result(monomials_.get_allocator());
+            while (!monomials_.empty()) {
+                auto node = monomials_.extract(monomials_.begin());
+                node.key() += term.degree;
+                node.mapped() *= term.coef;
+                result.insert(result.end(), std::move(node));
             }
             monomials_ = std::move(result);
-            Reduce();
             return *this;
         }
 
-        LocalPoly operator+(const LocalTerm& term) const {
-            LocalPoly poly(*this);
+        // *this -= reducer * term without materializing the product,
+        // every product term is merged right into this polynomial
+        LocalPoly& SubMulTerm(const LocalPoly& reducer, const LocalTerm& term) {
+            if (&reducer == this) {
+                return SubMulTerm(LocalPoly(reducer, get_allocator()), term);
+            }
+            Invalidate();
+
+            for (auto& [degree, coef] : reducer.monomials_) {
+                Monomial product(degree, get_allocator());
+                product += term.degree;
+                Field value = coef * term.coef;
+
+                auto it = monomials_.lower_bound(product);
+                if (it != monomials_.end() &&
+                    !monomials_.key_comp()(product, it->first)) {
+                    it->second -= value;
+                    if (it->second.IsZero()) {
+                        monomials_.erase(it);
+                    }
+                } else if (!value.IsZero()) {
+                    monomials_.emplace_hint(it, std::move(product), -value);
+                }
+            }
+            return *this;
+        }
+
+        LocalPoly operator+(const LocalTerm& term) const& {
+            LocalPoly poly(*this, get_allocator());
             poly += term;
             return poly;
         }
+        LocalPoly operator+(const LocalTerm& term) && {
+            *this += term;
+            return std::move(*this);
+        }
 
-        LocalPoly operator-(const LocalTerm& term) const {
-            LocalPoly poly(*this);
+        LocalPoly operator-(const LocalTerm& term) const& {
+            LocalPoly poly(*this, get_allocator());
             poly -= term;
             return poly;
         }
+        LocalPoly operator-(const LocalTerm& term) && {
+            *this -= term;
+            return std::move(*this);
+        }
 
-        LocalPoly operator*(const LocalTerm& term) const {
-            LocalPoly poly(*this);
+        LocalPoly operator*(const LocalTerm& term) const& {
+            LocalPoly poly(*this, get_allocator());
             poly *= term;
             return poly;
         }
+        LocalPoly operator*(const LocalTerm& term) && {
+            *this *= term;
+            return std::move(*this);
+        }
 
-        // TODO add == for Polynomial with different comparator
         bool operator==(const LocalPoly& other) const {
             return monomials_ == other.monomials_;
         }
+        template <IsComparator Other>
+        requires(!std::is_same_v<Other, Comparator>) bool operator==(
+            const Polynomial<Field, Other>& other) const {
+            if (GetSize() != other.GetSize()) {
+                return false;
+            }
+            for (const auto& [degree, coef] : other) {
+                auto it = monomials_.find(degree);
+                if (it == monomials_.end() || !(it->second == coef)) {
+                    return false;
+                }
+            }
+            return true;
+        }
         bool operator!=(const LocalPoly& other) const {
             return !(*this == other);
         }
 
     private:
-        void Reduce() {
-            for (auto it = monomials_.begin(); it != monomials_.end();) {
+        template <IsSupportedField, IsComparator>
+        friend class Polynomial;
+        template <IsSupportedField, IsComparator, size_t>
+        friend class LinearCombination;
+
+        void Invalidate() { metadata_.Clear(); }
+
+        // adds coef * degree with a single lookup
+        template <typename Degree, typename Coef>
+        void AddTerm(Degree&& degree, Coef&& coef) {
+            if (coef.IsZero()) {
+                return;
+            }
+            Invalidate();
+
+            auto it = monomials_.lower_bound(degree);
+            if (it != monomials_.end() &&
+                !monomials_.key_comp()(degree, it->first)) {
+                it->second += coef;
                 if (it->second.IsZero()) {
-                    monomials_.erase(it++);
-                } else {
-                    ++it;
+                    monomials_.erase(it);
                 }
+            } else {
+                monomials_.emplace_hint(it, std::forward<Degree>(degree),
+                                        std::forward<Coef>(coef));
             }
         }
 
-        struct Compare {
-                bool operator()(const Monomial& lhs,
-                                const Monomial& rhs) const {
-                    return Comparator::IsGreater(lhs, rhs);
+        void Negate() {
+            for (auto& [degree, coef] : monomials_) {
+                coef = -coef;
+            }
+        }
+
+        // Bulk construction: terms are sorted once through pointers,
+        // then like terms are combined and zeros dropped in one pass.
+        // The map is filled in order, so every insertion is amortized O(1).
+        // Monomials are moved out of the source when kMoveTerms is set.
+        template <bool kMoveTerms, std::forward_iterator It>
+        void AssignUnsorted(It begin, It end) {
+            using TermPtr = std::remove_reference_t<decltype(*begin)>*;
+
+            std::vector<TermPtr> terms;
+            terms.reserve(std::distance(begin, end));
+            for (auto cur = begin; cur != end; ++cur) {
+                terms.push_back(&*cur);
+            }
+            std::sort(terms.begin(), terms.end(),
+                      [](TermPtr lhs, TermPtr rhs) {
+                          return Comparator::IsGreater(lhs->degree,
+                                                       rhs->degree);
+                      });
+
+            monomials_.clear();
+            for (size_t i = 0; i < terms.size();) {
+                Field coef = terms[i]->coef;
+                size_t next = i + 1;
+                while (next < terms.size() &&
+                       !Comparator::IsGreater(terms[i]->degree,
+                                              terms[next]->degree)) {
+                    coef += terms[next]->coef;
+                    ++next;
                 }
-        };
 
-        using PolyTable = std::map<Monomial, Field, Compare>;
+                if (!coef.IsZero()) {
+                    if constexpr (kMoveTerms) {
+                        monomials_.emplace_hint(monomials_.end(),
+                                                std::move(terms[i]->degree),
+                                                std::move(coef));
+                    } else {
+                        monomials_.emplace_hint(monomials_.end(),
+                                                terms[i]->degree,
+                                                std::move(coef));
+                    }
+                }
+                i = next;
+            }
+            Invalidate();
+        }
+
+        // terms already sorted from the leader down and distinct
+        void AssignSorted(Details::TermBuffer<Field>& terms) {
+            monomials_.clear();
+            for (auto& [degree, coef] : terms) {
+                if (!coef.IsZero()) {
+                    monomials_.emplace_hint(monomials_.end(), std::move(degree),
+                                            std::move(coef));
+                }
+            }
+            Invalidate();
+        }
+
+        // same for (monomial, coef) entries of a polynomial in another
+        // order, they are distinct and non-zero already
+        template <std::forward_iterator It>
+        void AssignDistinct(It begin, It end) {
+            using EntryPtr = std::remove_reference_t<decltype(*begin)>*;
+
+            std::vector<EntryPtr> entries;
+            entries.reserve(std::distance(begin, end));
+            for (auto cur = begin; cur != end; ++cur) {
+                entries.push_back(&*cur);
+            }
+            std::sort(entries.begin(), entries.end(),
+                      [](EntryPtr lhs, EntryPtr rhs) {
+                          return Comparator::IsGreater(lhs->first,
+                                                       rhs->first);
+                      });
+
+            monomials_.clear();
+            for (EntryPtr entry : entries) {
+                monomials_.emplace_hint(monomials_.end(), entry->first,
+                                        entry->second);
+            }
+            Invalidate();
+        }
+
         // assuming monomials have different degrees (3x + 5x -> 8x)
         // and no monomials with coefficient 0
         PolyTable monomials_;
+        // not thread-safe: filled lazily from const accessors
+        mutable Metadata metadata_;
 };
 }  // namespace Groebner
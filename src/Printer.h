@@ -22,6 +22,13 @@ namespace Details {
             }
     };
 
+    template <>
+    struct FieldPrinter<BigRational> {
+            static void Print(std::ofstream& out) {
+                FieldPrinter<Rational>::Print(out);
+            }
+    };
+
     template <int64_t N>
     requires Groebner::IsPrime<N> struct FieldPrinter<Modulo<N>> {
             static void Print(std::ofstream& out) {
@@ -30,6 +37,31 @@ namespace Details {
             }
     };
 
+    template <>
+    struct FieldPrinter<RuntimeModulo> {
+            static void Print(std::ofstream& out) {
+                out << "Working in $\\mathbb{Z}_"
+                    << std::to_string(RuntimeModulo::GetModulus())
+                    << "$ field. ";
+            }
+    };
+
+    template <>
+    struct FieldPrinter<Gf2> {
+            static void Print(std::ofstream& out) {
+                out << "Working in $\\mathbb{F}_2$ field. ";
+            }
+    };
+
+    template <int64_t P, size_t K>
+    struct FieldPrinter<GaloisField<P, K>> {
+            static void Print(std::ofstream& out) {
+                out << "Working in $\\mathbb{F}_{" << std::to_string(P) << "^{"
+                    << std::to_string(K) << "}}$ field, $\\alpha$ is a root "
+                    << "of the defining polynomial. ";
+            }
+    };
+
     template <IsSupportedField T>
     struct CoefPrinter {
             static void Print(T coef, std::ofstream& out) {}
@@ -47,6 +79,64 @@ namespace Details {
             }
     };
 
+    template <>
+    struct CoefPrinter<BigRational> {
+            static void Print(const BigRational& coef, std::ofstream& out) {
+                if (coef.GetDenominator() == 1) {
+                    out << "$" << coef.GetNumerator().ToString() << "$";
+                } else {
+                    out << "$\\frac{" << coef.GetNumerator().ToString() << "}{"
+                        << coef.GetDenominator().ToString() << "}$";
+                }
+            }
+    };
+
+    template <>
+    struct CoefPrinter<RuntimeModulo> {
+            static void Print(RuntimeModulo coef, std::ofstream& out) {
+                out << "$" << coef.GetValue() << "$";
+            }
+    };
+
+    template <>
+    struct CoefPrinter<Gf2> {
+            static void Print(Gf2 coef, std::ofstream& out) {
+                out << "$" << static_cast<int>(coef.GetValue()) << "$";
+            }
+    };
+
+    // as a polynomial in the root alpha, sums in brackets
+    template <int64_t P, size_t K>
+    struct CoefPrinter<GaloisField<P, K>> {
+            static void Print(const GaloisField<P, K>& coef,
+                              std::ofstream& out) {
+                std::string terms;
+                size_t count = 0;
+                for (size_t i = K; i-- > 0;) {
+                    int64_t value = coef.GetCoefficient(i);
+                    if (value == 0) {
+                        continue;
+                    }
+                    if (count++ > 0) {
+                        terms += " + ";
+                    }
+                    if (value != 1 || i == 0) {
+                        terms += std::to_string(value);
+                    }
+                    if (i > 0) {
+                        terms += "\\alpha";
+                    }
+                    if (i > 1) {
+                        terms += "^{" + std::to_string(i) + "}";
+                    }
+                }
+                if (count == 0) {
+                    terms = "0";
+                }
+                out << (count > 1 ? "$(" + terms + ")$" : "$" + terms + "$");
+            }
+    };
+
     template <size_t N>
     requires Groebner::IsPrime<N> struct CoefPrinter<Modulo<N>> {
             static void Print(Modulo<N> coef, std::ofstream& out) {
@@ -148,13 +238,14 @@ class Printer {
             if (poly.IsZero()) {
                 PrintMessage("$0$", description, NO_NEW_LINE);
             }
-            for (size_t i = 0; i < poly.GetSize(); i++) {
-                auto [coef, degree] = poly.GetAt(i);
-                if (i > 0 && coef > 0) {
+            bool is_first = true;
+            for (const auto& [degree, coef] : poly) {
+                if (!is_first && coef > 0) {
                     PrintMessage(" + ", description, NO_NEW_LINE);
-                } else if (i > 0 && coef < 0) {
+                } else if (!is_first && coef < 0) {
                     PrintMessage(" $-$ ", description, NO_NEW_LINE);
                 }
+                is_first = false;
                 if (DoPrintCoef(coef.Abs(), degree)) {
                     Details::CoefPrinter<Field>::Print(coef.Abs(), *out_);
                 }
@@ -438,7 +529,9 @@ class Printer {
             if (coef == 1) {
                 return false;
             }
-            if (std::is_same_v<Field, Rational> && coef == -1) {
+            if ((std::is_same_v<Field, Rational> ||
+                 std::is_same_v<Field, BigRational>) &&
+                coef == -1) {
                 return false;
             }
 
@@ -38,7 +38,12 @@ Rational Rational::Abs() const {
     return Rational(std::abs(numerator_), denominator_);
 }
 
+// integers, as in fraction-free computations, need no lcm and no gcd
 Rational& Rational::operator+=(const Rational& other) {
+    if (denominator_ == 1 && other.denominator_ == 1) {
+        numerator_ += other.numerator_;
+        return *this;
+    }
     ValueType lcm = std::lcm(denominator_, other.denominator_);
     numerator_ = numerator_ * (lcm / denominator_) +
                  other.numerator_ * (lcm / other.denominator_);
@@ -48,6 +53,10 @@ Rational& Rational::operator+=(const Rational& other) {
 }
 
 Rational& Rational::operator-=(const Rational& other) {
+    if (denominator_ == 1 && other.denominator_ == 1) {
+        numerator_ -= other.numerator_;
+        return *this;
+    }
     ValueType lcm = std::lcm(denominator_, other.denominator_);
     numerator_ = numerator_ * (lcm / denominator_) -
                  other.numerator_ * (lcm / other.denominator_);
@@ -57,6 +66,10 @@ Rational& Rational::operator-=(const Rational& other) {
 }
 
 Rational& Rational::operator*=(const Rational& other) {
+    if (denominator_ == 1 && other.denominator_ == 1) {
+        numerator_ *= other.numerator_;
+        return *this;
+    }
     numerator_ *= other.numerator_;
     denominator_ *= other.denominator_;
     Reduce();
@@ -0,0 +1,46 @@
+#include "RuntimeModulo.h"
+
+#include <algorithm>
+
+namespace Groebner {
+namespace Details {
+    RuntimeModuloContext::RuntimeModuloContext(ModuloValueType modulus)
+        : modulus_(modulus),
+          is_small_(static_cast<uint64_t>(modulus) < kBarrettLimit),
+          barrett_(modulus),
+          montgomery_(modulus) {
+        assert(IsPrime(modulus) && "Modulus must be prime");
+        inverses_ = BuildInverseTable(modulus,
+                                      std::min(modulus, kInverseTableSize));
+    }
+
+    ModuloValueType RuntimeModuloContext::GetInverse(
+        ModuloValueType value) const {
+        assert(value != 0 && "No inverse element for zero");
+        if (value < static_cast<ModuloValueType>(inverses_.size())) {
+            return inverses_[value];
+        }
+        ModuloValueType x, y;
+        FindGcdExtended(value, modulus_, &x, &y);
+        return x < 0 ? x + modulus_ : x;
+    }
+}  // namespace Details
+
+RuntimeModulo::Scope::Scope(ValueType modulus)
+    : context_(std::in_place, modulus), previous_(RuntimeModulo::context_) {
+    RuntimeModulo::context_ = &*context_;
+}
+
+RuntimeModulo::Scope::Scope(const Capture& capture)
+    : previous_(RuntimeModulo::context_) {
+    assert(capture.context_ && "No RuntimeModulo::Scope to capture");
+    RuntimeModulo::context_ = capture.context_;
+}
+
+RuntimeModulo::Scope::~Scope() {
+    RuntimeModulo::context_ = previous_;
+}
+
+RuntimeModulo::Capture::Capture() : context_(RuntimeModulo::context_) {}
+
+}  // namespace Groebner
@@ -0,0 +1,217 @@
+#pragma once
+
+#include "Modulo.h"
+
+#include <cassert>
+#include <cinttypes>
+#include <optional>
+#include <vector>
+
+namespace Groebner {
+namespace Details {
+    // everything RuntimeModulo derives from the prime once
+    class RuntimeModuloContext {
+        public:
+            explicit RuntimeModuloContext(ModuloValueType modulus);
+
+            ModuloValueType GetModulus() const { return modulus_; }
+
+            uint64_t Reduce(uint64_t x) const {
+                if (is_small_) {
+                    return barrett_.Reduce(x);
+                }
+                return x % modulus_;
+            }
+
+            uint64_t Multiply(uint64_t lhs, uint64_t rhs) const {
+                if (is_small_) {
+                    return barrett_.Multiply(lhs, rhs);
+                }
+                return montgomery_.Multiply(lhs, rhs);
+            }
+
+            uint64_t ReduceWide(unsigned __int128 x) const {
+                if (is_small_) {
+                    return barrett_.ReduceWide(x);
+                }
+                return montgomery_.ReduceWide(x);
+            }
+
+            ModuloValueType GetInverse(ModuloValueType value) const;
+
+        private:
+            ModuloValueType modulus_;
+            bool is_small_;
+            BarrettReducer barrett_;
+            MontgomeryReducer montgomery_;
+            // inverses_[i] = i^{-1} for small i, the rest use extended gcd
+            std::vector<ModuloValueType> inverses_;
+    };
+}  // namespace Details
+
+// Prime field whose modulus is chosen at run time. The modulus and its
+// precomputed constants live in a RuntimeModulo::Scope, elements are just
+// values and use the innermost scope alive on their thread, so elements
+// must not outlive it or be mixed across scopes of different primes.
+class RuntimeModulo {
+    public:
+        using ValueType = Details::ModuloValueType;
+
+        class Capture;
+
+        // makes modulus current on this thread until destruction,
+        // scopes nest and restore the previous modulus
+        class Scope {
+            public:
+                explicit Scope(ValueType modulus);
+                // makes the captured modulus current, e.g. on a worker
+                // thread, without recomputing its constants
+                explicit Scope(const Capture& capture);
+                ~Scope();
+
+                Scope(const Scope&) = delete;
+                Scope& operator=(const Scope&) = delete;
+
+            private:
+                std::optional<Details::RuntimeModuloContext> context_;
+                const Details::RuntimeModuloContext* previous_;
+        };
+
+        // the modulus current on the creating thread, to be made current
+        // on other threads; the scope it came from must outlive them
+        class Capture {
+            public:
+                Capture();
+
+            private:
+                friend class Scope;
+
+                const Details::RuntimeModuloContext* context_;
+        };
+
+        // zero needs no scope, so buffers of elements can be made anywhere
+        RuntimeModulo(ValueType value = 0) : value_(value) {
+            if (value_ != 0) {
+                Normalize();
+            }
+        }
+
+        static ValueType GetModulus() { return GetContext().GetModulus(); }
+
+        // element congruent to an unreduced non-negative value,
+        // such as a sum of products
+        static RuntimeModulo FromUnreduced(unsigned __int128 value) {
+            RuntimeModulo result;
+            result.value_ =
+                static_cast<ValueType>(GetContext().ReduceWide(value));
+            return result;
+        }
+
+        ValueType GetValue() const { return value_; }
+
+        bool IsZero() const { return value_ == 0; }
+
+        RuntimeModulo Abs() const { return *this; }
+
+        RuntimeModulo operator-() const {
+            RuntimeModulo result;
+            result.value_ = -value_;
+            result.value_ += GetModulus() & (result.value_ >> 63);
+            return result;
+        }
+        RuntimeModulo operator+() const { return *this; }
+
+        RuntimeModulo& operator+=(const RuntimeModulo& other) {
+            value_ += other.value_ - GetModulus();
+            value_ += GetModulus() & (value_ >> 63);
+            return *this;
+        }
+
+        RuntimeModulo& operator-=(const RuntimeModulo& other) {
+            value_ -= other.value_;
+            value_ += GetModulus() & (value_ >> 63);
+            return *this;
+        }
+
+        RuntimeModulo& operator*=(const RuntimeModulo& other) {
+            value_ = GetContext().Multiply(value_, other.value_);
+            return *this;
+        }
+
+        RuntimeModulo& operator/=(const RuntimeModulo& other) {
+            assert(other.value_ != 0 && "Can't divide by zero");
+            value_ = GetContext().Multiply(
+                value_, GetContext().GetInverse(other.value_));
+            return *this;
+        }
+
+        RuntimeModulo operator+(const RuntimeModulo& other) const {
+            RuntimeModulo temp(*this);
+            temp += other;
+            return temp;
+        }
+
+        RuntimeModulo operator-(const RuntimeModulo& other) const {
+            RuntimeModulo temp(*this);
+            temp -= other;
+            return temp;
+        }
+
+        RuntimeModulo operator*(const RuntimeModulo& other) const {
+            RuntimeModulo temp(*this);
+            temp *= other;
+            return temp;
+        }
+
+        RuntimeModulo operator/(const RuntimeModulo& other) const {
+            RuntimeModulo temp(*this);
+            temp /= other;
+            return temp;
+        }
+
+        bool operator==(const RuntimeModulo& other) const {
+            return value_ == other.value_;
+        }
+
+        bool operator!=(const RuntimeModulo& other) const {
+            return !(*this == other);
+        }
+
+        bool operator<(const RuntimeModulo& other) const {
+            return value_ < other.value_;
+        }
+
+        bool operator<=(const RuntimeModulo& other) const {
+            return value_ <= other.value_;
+        }
+
+        bool operator>(const RuntimeModulo& other) const {
+            return other < *this;
+        }
+
+        bool operator>=(const RuntimeModulo& other) const {
+            return other <= *this;
+        }
+
+    private:
+        static const Details::RuntimeModuloContext& GetContext() {
+            assert(context_ && "No RuntimeModulo::Scope on this thread");
+            return *context_;
+        }
+
+        void Normalize() {
+            uint64_t magnitude = value_ < 0 ? 0 - static_cast<uint64_t>(value_)
+                                            : static_cast<uint64_t>(value_);
+            ValueType reduced = GetContext().Reduce(magnitude);
+            value_ = value_ < 0 ? -reduced : reduced;
+            value_ += GetModulus() & (value_ >> 63);
+        }
+
+        static inline thread_local const Details::RuntimeModuloContext*
+            context_ = nullptr;
+
+        // 0 <= value_ < GetModulus()
+        ValueType value_;
+};
+
+}  // namespace Groebner
@@ -0,0 +1,252 @@
+#pragma once
+
+#include "MonomialCompare.h"
+
+#include <array>
+#include <compare>
+
+namespace Groebner {
+
+// Row of non-negative weights, variables past the end of the row weigh 0.
+template <Monomial::DegreeType... Values>
+struct Weights {
+        static constexpr std::array<Monomial::DegreeType, sizeof...(Values)>
+            kValues{Values...};
+
+        static Monomial::DegreeType Dot(Details::DegreeSpan degrees) {
+            Monomial::DegreeType result = 0;
+            if (degrees.size() >= kValues.size()) {
+                // fixed trip count, unrolled with the weights folded in
+                for (size_t i = 0; i < kValues.size(); ++i) {
+                    result += kValues[i] * degrees[i];
+                }
+                return result;
+            }
+            for (size_t i = 0; i < degrees.size(); ++i) {
+                result += kValues[i] * degrees[i];
+            }
+            return result;
+        }
+
+        // weighted degrees of both, in one pass when the row fits
+        static std::strong_ordering Compare(Details::DegreeSpan lhs,
+                                            Details::DegreeSpan rhs) {
+            if (lhs.size() < kValues.size() || rhs.size() < kValues.size()) {
+                return Dot(lhs) <=> Dot(rhs);
+            }
+            Monomial::DegreeType lhs_result = 0;
+            Monomial::DegreeType rhs_result = 0;
+            for (size_t i = 0; i < kValues.size(); ++i) {
+                lhs_result += kValues[i] * lhs[i];
+                rhs_result += kValues[i] * rhs[i];
+            }
+            return lhs_result <=> rhs_result;
+        }
+};
+
+namespace Details {
+    template <typename T>
+    struct IsWeightsImpl : std::false_type {};
+
+    template <Monomial::DegreeType... Values>
+    struct IsWeightsImpl<Weights<Values...>> : std::true_type {};
+
+    template <typename T>
+    concept IsWeights = IsWeightsImpl<T>::value;
+
+    // orders that can compare a block of variables on their own
+    template <typename Order>
+    struct BlockTraits;
+
+    template <>
+    struct BlockTraits<LexOrder> {
+            static constexpr bool kGraded = false;
+
+            static std::strong_ordering Compare(DegreeSpan lhs,
+                                                DegreeSpan rhs) {
+                return CompareLex(lhs, rhs);
+            }
+    };
+
+    template <>
+    struct BlockTraits<GrlexOrder> {
+            static constexpr bool kGraded = true;
+
+            static std::strong_ordering Compare(DegreeSpan lhs,
+                                                DegreeSpan rhs) {
+                return CompareLex(lhs, rhs);
+            }
+    };
+
+    template <>
+    struct BlockTraits<GrevlexOrder> {
+            static constexpr bool kGraded = true;
+
+            static std::strong_ordering Compare(DegreeSpan lhs,
+                                                DegreeSpan rhs) {
+                return CompareReverseLex(lhs, rhs);
+            }
+    };
+
+    template <typename T>
+    concept IsBlockOrder = requires { BlockTraits<T>::kGraded; };
+
+}  // namespace Details
+
+// Weighted degree first, ties are broken by Tiebreak order.
+template <Details::IsWeights Row, Details::IsBlockOrder Tiebreak = GrevlexOrder>
+class WeightedOrder : public StraightCoordinateOrder {
+    public:
+        WeightedOrder() = delete;
+
+        // weighted degree, a short dot product computed on every
+        // comparison, so monomials carry no per-order state
+        static Monomial::DegreeType GetKey(const Monomial& monomial) {
+            return Row::Dot(monomial.GetDegrees());
+        }
+
+        static std::strong_ordering Compare(const Monomial& lhs,
+                                            const Monomial& rhs) {
+            if (auto cmp = Row::Compare(lhs.GetDegrees(), rhs.GetDegrees());
+                cmp != 0) {
+                return cmp;
+            }
+            return Tiebreak::Compare(lhs, rhs);
+        }
+
+        static bool IsLess(const Monomial& lhs, const Monomial& rhs) {
+            return Compare(lhs, rhs) < 0;
+        }
+        static bool IsGreater(const Monomial& lhs, const Monomial& rhs) {
+            return Compare(lhs, rhs) > 0;
+        }
+        static bool IsLessOrEqual(const Monomial& lhs, const Monomial& rhs) {
+            return Compare(lhs, rhs) <= 0;
+        }
+        static bool IsGreaterOrEqual(const Monomial& lhs,
+                                     const Monomial& rhs) {
+            return Compare(lhs, rhs) >= 0;
+        }
+};
+
+// Product (elimination) order: variables [0, Split) are compared by First,
+// and only on a tie the rest are compared by Second.
+// BlockOrder<k, LexOrder, GrevlexOrder> eliminates the first k variables.
+template <size_t Split, Details::IsBlockOrder First,
+          Details::IsBlockOrder Second>
+class BlockOrder : public StraightCoordinateOrder {
+    public:
+        BlockOrder() = delete;
+
+        // sum degree of the first block
+        static Monomial::DegreeType GetKey(const Monomial& monomial) {
+            auto head = GetHead(monomial.GetDegrees());
+            return std::accumulate(head.begin(), head.end(), 0ULL);
+        }
+
+        static std::strong_ordering Compare(const Monomial& lhs,
+                                            const Monomial& rhs) {
+            auto lhs_degrees = lhs.GetDegrees();
+            auto rhs_degrees = rhs.GetDegrees();
+
+            if constexpr (Details::BlockTraits<First>::kGraded) {
+                if (auto cmp = GetKey(lhs) <=> GetKey(rhs); cmp != 0) {
+                    return cmp;
+                }
+            }
+            if (auto cmp = Details::BlockTraits<First>::Compare(
+                    GetHead(lhs_degrees), GetHead(rhs_degrees));
+                cmp != 0) {
+                return cmp;
+            }
+
+            // heads are equal here, so are their degrees
+            if constexpr (Details::BlockTraits<Second>::kGraded) {
+                if (auto cmp = lhs.GetSumDegree() <=> rhs.GetSumDegree();
+                    cmp != 0) {
+                    return cmp;
+                }
+            }
+            return Details::BlockTraits<Second>::Compare(GetTail(lhs_degrees),
+                                                         GetTail(rhs_degrees));
+        }
+
+        static bool IsLess(const Monomial& lhs, const Monomial& rhs) {
+            return Compare(lhs, rhs) < 0;
+        }
+        static bool IsGreater(const Monomial& lhs, const Monomial& rhs) {
+            return Compare(lhs, rhs) > 0;
+        }
+        static bool IsLessOrEqual(const Monomial& lhs, const Monomial& rhs) {
+            return Compare(lhs, rhs) <= 0;
+        }
+        static bool IsGreaterOrEqual(const Monomial& lhs,
+                                     const Monomial& rhs) {
+            return Compare(lhs, rhs) >= 0;
+        }
+
+    private:
+        static Details::DegreeSpan GetHead(Details::DegreeSpan degrees) {
+            return degrees.first(std::min(degrees.size(), Split));
+        }
+
+        static Details::DegreeSpan GetTail(Details::DegreeSpan degrees) {
+            return degrees.subspan(std::min(degrees.size(), Split));
+        }
+};
+
+// Rows are compared one by one as weighted degrees,
+// ties after the last row are broken by LexOrder.
+template <Details::IsWeights... Rows>
+requires(sizeof...(Rows) > 0) class MatrixOrder
+    : public StraightCoordinateOrder {
+    public:
+        MatrixOrder() = delete;
+
+        using Key = std::array<Monomial::DegreeType, sizeof...(Rows)>;
+
+        // weighted degrees of every row
+        static Key GetKey(const Monomial& monomial) {
+            return {Rows::Dot(monomial.GetDegrees())...};
+        }
+
+        static std::strong_ordering Compare(const Monomial& lhs,
+                                            const Monomial& rhs) {
+            if (auto cmp = CompareRows<Rows...>(lhs.GetDegrees(),
+                                                rhs.GetDegrees());
+                cmp != 0) {
+                return cmp;
+            }
+            return LexOrder::Compare(lhs, rhs);
+        }
+
+        static bool IsLess(const Monomial& lhs, const Monomial& rhs) {
+            return Compare(lhs, rhs) < 0;
+        }
+        static bool IsGreater(const Monomial& lhs, const Monomial& rhs) {
+            return Compare(lhs, rhs) > 0;
+        }
+        static bool IsLessOrEqual(const Monomial& lhs, const Monomial& rhs) {
+            return Compare(lhs, rhs) <= 0;
+        }
+        static bool IsGreaterOrEqual(const Monomial& lhs,
+                                     const Monomial& rhs) {
+            return Compare(lhs, rhs) >= 0;
+        }
+
+    private:
+        // rows are evaluated only until the first one that differs
+        template <typename Row, typename... Rest>
+        static std::strong_ordering CompareRows(Details::DegreeSpan lhs,
+                                                Details::DegreeSpan rhs) {
+            auto cmp = Row::Compare(lhs, rhs);
+            if constexpr (sizeof...(Rest) > 0) {
+                if (cmp == 0) {
+                    return CompareRows<Rest...>(lhs, rhs);
+                }
+            }
+            return cmp;
+        }
+};
+
+}  // namespace Groebner